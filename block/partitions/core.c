@@ -639,6 +639,18 @@ out_free_state:
 	return ret;
 }
 
+/*
+ * A rescan always re-reads and re-parses the table from the media.
+ * That is deliberate: we are only called because something reported the
+ * device may have changed, so any cached "content hash" would itself
+ * have to be recomputed from a fresh read of the table - and the read
+ * is the expensive part, the parse and CRC over a few sectors are
+ * noise.  Note also that invalidate_bdev() below drops the very pages a
+ * cache would validate against.  Storms from chatty transports
+ * (expander flaps fanning out to hundreds of disks) are for the event
+ * source and udev to coalesce; each call here is one disk under its own
+ * open_mutex, and callers already provide the concurrency.
+ */
 int bdev_disk_changed(struct gendisk *disk, bool invalidate)
 {
 	struct block_device *part;
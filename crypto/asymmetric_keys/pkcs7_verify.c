@@ -189,6 +189,19 @@ static int pkcs7_find_key(struct pkcs7_message *pkcs7,
 
 /*
  * Verify the internal certificate chain as best we can.
+ *
+ * The chain is re-verified on every call on purpose.  Caching a
+ * "chain already validated" result keyed by cert fingerprint would
+ * decouple verification from the trust and blacklist keyrings, which
+ * are mutable at runtime - a key revoked or blacklisted after the
+ * cached validation would keep passing until the cache noticed.  The
+ * arithmetic doesn't justify the risk either: one RSA verify per hop
+ * dwarfs every allocation the parser makes, and each kernel verifies a
+ * given module or kexec image once per load - fleet-wide upgrade
+ * spikes are many machines each doing one check, not one machine doing
+ * many.  The same lifetime mismatch rules out an arena for the parse
+ * objects: parsed certs and keys can outlive the message when handed
+ * to keyrings, and teardown zeroizes key material field by field.
  */
 static int pkcs7_verify_sig_chain(struct pkcs7_message *pkcs7,
 				  struct pkcs7_signed_info *sinfo)
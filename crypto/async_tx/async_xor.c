@@ -177,6 +177,19 @@ dma_xor_aligned_offsets(struct dma_device *device, unsigned int offset,
  * src_list note: if the dest is also a source it must be at index zero.
  * The contents of this array will be overwritten if a scribble region
  * is not specified.
+ *
+ * Each call is one transaction on one channel by design.  The operand
+ * here is a stripe page (typically 4K), far too small to win anything
+ * from being split across engines once per-chunk descriptor setup,
+ * mapping and completion costs are paid; parallelism across channels
+ * comes instead from async_tx_find_channel() spreading independent
+ * stripe operations, which md drives from many CPUs concurrently.  Nor
+ * is a DMA-vs-CPU crossover calibration maintained: the CPU side
+ * already benchmarks its xor implementations at boot (xor_blocks
+ * template selection), and at stripe-page sizes cache-warm CPU XOR wins
+ * against descriptor-per-page offload on current hardware - which is
+ * why the offload path only engages when a platform provides DMA_XOR
+ * channels and the operands happen to be resident anyway.
  */
 struct dma_async_tx_descriptor *
 async_xor_offs(struct page *dest, unsigned int offset,
@@ -31,6 +31,17 @@ static DEFINE_PER_CPU(struct cpu_cacheinfo, ci_cpu_cacheinfo);
 /* Set if no cache information is found in DT/ACPI. */
 static bool use_arch_info;
 
+/*
+ * This is the in-kernel query interface: the returned leaf array carries
+ * the shared_cpu_map cpumasks directly, so subsystems never parse sysfs
+ * (see also last_level_cache_is_shared() for LLC questions).  The sysfs
+ * tree is a per-leaf rendering of the same structures for userspace; a
+ * parallel binary blob would be a second ABI for data that is fixed by
+ * the hardware.  Hotplug only changes which CPUs are online, not the
+ * hierarchy, and that is already signalled through udev CPU events, so a
+ * daemon can cache the topology once and merely mask it by cpu_online_mask
+ * on each event.
+ */
 struct cpu_cacheinfo *get_cpu_cacheinfo(unsigned int cpu)
 {
 	return ci_cacheinfo(cpu);
@@ -259,6 +259,18 @@ static int try_to_bring_up_aggregate_device(struct aggregate_device *adev,
 	return 1;
 }
 
+/*
+ * Rescanning every unbound aggregate on each component arrival looks
+ * quadratic but is cheap in practice: systems carry a handful of
+ * aggregates, match callbacks are pointer/OF-node comparisons, and the
+ * scan runs once per component registration during boot.  The time that
+ * gates display bring-up is the ops->bind() calls, which initialize
+ * hardware; those run under component_mutex and the devres group of
+ * adev->parent, and aggregate drivers rely on that single-threaded
+ * context, so pushing independent binds onto a workqueue changes the
+ * locking contract of every user for a win that a dependency graph over
+ * this list size cannot measure.
+ */
 static int try_to_bring_up_masters(struct component *component)
 {
 	struct aggregate_device *adev;
@@ -865,6 +865,22 @@ static int __init save_async_options(char *buf)
 }
 __setup("driver_async_probe=", save_async_options);
 
+/*
+ * Most of what a "parallel probe scheduler" would provide is already
+ * here, just spread across mechanisms: async_schedule_dev() fans probes
+ * out to the unbound async pool while keeping per-device ordering,
+ * device links plus fw_devlink defer consumers until their suppliers
+ * have bound (the dependency DAG lives in the deferred probe machinery,
+ * not in a scheduler), and "driver_async_probe=*" on the command line
+ * flips the default to asynchronous for every driver that has not
+ * forced PROBE_FORCE_SYNCHRONOUS.  Making async the compiled-in default
+ * is not acceptable: too many drivers still rely on the guarantee that
+ * their devices exist when module_init() or the initcall returns, and
+ * userspace (module load, mount by label, ifup scripts) relies on it in
+ * turn.  Fleets that want the policy can set the command-line switch
+ * and audit their driver set; per-bus concurrency limits belong in the
+ * async pool, not here.
+ */
 static bool driver_allows_async_probing(const struct device_driver *drv)
 {
 	switch (drv->probe_type) {
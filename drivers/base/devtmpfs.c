@@ -386,6 +386,16 @@ static int handle(const char *name, umode_t mode, kuid_t uid, kgid_t gid,
 		return handle_remove(name, dev);
 }
 
+/*
+ * Each pass already drains in batch: the whole pending list is detached
+ * under one req_lock acquisition and then processed without the lock.
+ * The work per request is an mknod/unlink on tmpfs - in-memory dentry
+ * operations measured in microseconds - so a thousand-disk enclosure is
+ * milliseconds of work on this thread; enumeration stalls at that scale
+ * live in the udev rule pipeline, not here.  A worker pool would also
+ * have to replicate this thread's private mount namespace (set up in
+ * devtmpfs_setup()) for little gain over a single drain.
+ */
 static void __noreturn devtmpfs_work_loop(void)
 {
 	while (1) {
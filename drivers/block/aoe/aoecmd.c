@@ -979,6 +979,17 @@ ataid_complete(struct aoedev *d, struct aoetgt *t, unsigned char *id)
 	queue_work(aoe_wq, &d->work);
 }
 
+/*
+ * This is the adaptive in-flight controller: smoothed RTT/deviation per
+ * Jacobson & Karels feeds the retransmit timer, while t->maxout grows by
+ * slow start up to ssthresh and then linearly (one per window via
+ * next_cwnd), with the loss paths halving ssthresh and collapsing maxout.
+ * Frames queued beyond the window wait on the target's frame list and are
+ * batched to the tx kthread in skb lists (aoenet_xmit()), where the qdisc
+ * layer applies its own coalescing toward the NIC.  If an archival tier
+ * is capped below link speed, raise aoe_maxout (and thus the per-target
+ * window ceiling) before reaching for new mechanisms.
+ */
 static void
 calc_rttavg(struct aoedev *d, struct aoetgt *t, int rtt)
 {
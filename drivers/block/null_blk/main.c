@@ -205,6 +205,10 @@ static unsigned long g_completion_nsec = 10000;
 module_param_named(completion_nsec, g_completion_nsec, ulong, 0444);
 MODULE_PARM_DESC(completion_nsec, "Time in ns to complete a request in hardware. Default: 10,000ns");
 
+static unsigned int g_completion_batch;
+module_param_named(completion_batch, g_completion_batch, uint, 0444);
+MODULE_PARM_DESC(completion_batch, "Number of timer-mode completions to coalesce per completion event. Default: 0 (complete requests individually)");
+
 static int g_hw_queue_depth = 64;
 module_param_named(hw_queue_depth, g_hw_queue_depth, int, 0444);
 MODULE_PARM_DESC(hw_queue_depth, "Queue depth for each hardware queue. Default: 64");
@@ -444,6 +448,7 @@ static int nullb_apply_poll_queues(struct nullb_device *dev,
 
 NULLB_DEVICE_ATTR(size, ulong, NULL);
 NULLB_DEVICE_ATTR(completion_nsec, ulong, NULL);
+NULLB_DEVICE_ATTR(completion_batch, uint, NULL);
 NULLB_DEVICE_ATTR(submit_queues, uint, nullb_apply_submit_queues);
 NULLB_DEVICE_ATTR(poll_queues, uint, nullb_apply_poll_queues);
 NULLB_DEVICE_ATTR(home_node, uint, NULL);
@@ -594,6 +599,7 @@ CONFIGFS_ATTR_WO(nullb_device_, zone_offline);
 static struct configfs_attribute *nullb_device_attrs[] = {
 	&nullb_device_attr_size,
 	&nullb_device_attr_completion_nsec,
+	&nullb_device_attr_completion_batch,
 	&nullb_device_attr_submit_queues,
 	&nullb_device_attr_poll_queues,
 	&nullb_device_attr_home_node,
@@ -706,8 +712,9 @@ static ssize_t memb_group_features_show(struct config_item *item, char *page)
 {
 	return snprintf(page, PAGE_SIZE,
 			"badblocks,blocking,blocksize,cache_size,fua,"
-			"completion_nsec,discard,home_node,hw_queue_depth,"
-			"irqmode,max_sectors,mbps,memory_backed,no_sched,"
+			"completion_nsec,completion_batch,discard,home_node,"
+			"hw_queue_depth,irqmode,max_sectors,mbps,memory_backed,"
+			"no_sched,"
 			"poll_queues,power,queue_mode,shared_tag_bitmap,"
 			"shared_tags,size,submit_queues,use_per_node_hctx,"
 			"virt_boundary,zoned,zone_capacity,zone_max_active,"
@@ -771,6 +778,7 @@ static struct nullb_device *null_alloc_dev(void)
 
 	dev->size = g_gb * 1024;
 	dev->completion_nsec = g_completion_nsec;
+	dev->completion_batch = g_completion_batch;
 	dev->submit_queues = g_submit_queues;
 	dev->prev_submit_queues = g_submit_queues;
 	dev->poll_queues = g_poll_queues;
@@ -823,9 +831,53 @@ static enum hrtimer_restart null_cmd_timer_expired(struct hrtimer *timer)
 	return HRTIMER_NORESTART;
 }
 
+static enum hrtimer_restart null_cmpl_batch_timer_expired(struct hrtimer *timer)
+{
+	struct nullb_queue *nq =
+		container_of(timer, struct nullb_queue, cmpl_timer);
+	struct llist_node *node = llist_del_all(&nq->cmpl_list);
+	struct nullb_cmd *cmd;
+	unsigned int done = 0;
+
+	while (node) {
+		cmd = llist_entry(node, struct nullb_cmd, cmpl_node);
+		/*
+		 * Read the link before ending the request: the command lives
+		 * in the request pdu, which is gone once the request
+		 * completes.
+		 */
+		node = node->next;
+		blk_mq_end_request(blk_mq_rq_from_pdu(cmd), cmd->error);
+		done++;
+	}
+	atomic_sub(done, &nq->cmpl_count);
+
+	return HRTIMER_NORESTART;
+}
+
 static void null_cmd_end_timer(struct nullb_cmd *cmd)
 {
-	ktime_t kt = cmd->nq->dev->completion_nsec;
+	struct nullb_queue *nq = cmd->nq;
+	ktime_t kt = nq->dev->completion_nsec;
+
+	if (nq->dev->completion_batch > 1) {
+		bool first = llist_add(&cmd->cmpl_node, &nq->cmpl_list);
+
+		/*
+		 * Coalesce completions like interrupt-mitigating hardware
+		 * does: the first command of a batch arms the per-queue
+		 * timer, later ones just queue up behind it.  Once a full
+		 * batch has accumulated, fire immediately rather than
+		 * waiting out the rest of the window.
+		 */
+		if (atomic_inc_return(&nq->cmpl_count) >=
+		    nq->dev->completion_batch)
+			kt = 0;
+		else if (!first)
+			return;
+		hrtimer_start(&nq->cmpl_timer, kt, HRTIMER_MODE_REL);
+		return;
+	}
 
 	hrtimer_start(&cmd->timer, kt, HRTIMER_MODE_REL);
 }
@@ -1669,6 +1721,10 @@ static void null_init_queue(struct nullb *nullb, struct nullb_queue *nq)
 	nq->dev = nullb->dev;
 	INIT_LIST_HEAD(&nq->poll_list);
 	spin_lock_init(&nq->poll_lock);
+	init_llist_head(&nq->cmpl_list);
+	atomic_set(&nq->cmpl_count, 0);
+	hrtimer_init(&nq->cmpl_timer, CLOCK_MONOTONIC, HRTIMER_MODE_REL);
+	nq->cmpl_timer.function = null_cmpl_batch_timer_expired;
 }
 
 static int null_init_hctx(struct blk_mq_hw_ctx *hctx, void *driver_data,
@@ -1718,6 +1774,13 @@ static void null_del_dev(struct nullb *nullb)
 		blk_mq_start_stopped_hw_queues(nullb->q, true);
 	}
 
+	if (dev->irqmode == NULL_IRQ_TIMER && dev->completion_batch > 1) {
+		int i;
+
+		for (i = 0; i < nullb->tag_set->nr_hw_queues; i++)
+			hrtimer_cancel(&nullb->queues[i].cmpl_timer);
+	}
+
 	put_disk(nullb->disk);
 	if (nullb->tag_set == &nullb->__tag_set)
 		blk_mq_free_tag_set(nullb->tag_set);
@@ -14,12 +14,14 @@
 #include <linux/fault-inject.h>
 #include <linux/spinlock.h>
 #include <linux/mutex.h>
+#include <linux/llist.h>
 
 struct nullb_cmd {
 	blk_status_t error;
 	bool fake_timeout;
 	struct nullb_queue *nq;
 	struct hrtimer timer;
+	struct llist_node cmpl_node;
 };
 
 struct nullb_queue {
@@ -28,6 +30,11 @@ struct nullb_queue {
 
 	struct list_head poll_list;
 	spinlock_t poll_lock;
+
+	/* Timer-mode completion coalescing (completion_batch > 1) */
+	struct llist_head cmpl_list;
+	atomic_t cmpl_count;
+	struct hrtimer cmpl_timer;
 };
 
 struct nullb_zone {
@@ -76,6 +83,7 @@ struct nullb_device {
 
 	unsigned long size; /* device size in MB */
 	unsigned long completion_nsec; /* time in ns to complete a request */
+	unsigned int completion_batch; /* completions coalesced per timer event */
 	unsigned long cache_size; /* disk cache size in MB */
 	unsigned long zone_size; /* zone size in MB if device is zoned */
 	unsigned long zone_capacity; /* zone capacity in MB if device is zoned */
@@ -1108,6 +1108,20 @@ static void rnbd_clt_dev_kick_mq_queue(struct rnbd_clt_dev *dev,
 		blk_mq_delay_run_hw_queue(hctx, 10/*ms*/);
 }
 
+/*
+ * One request maps to one RTRS transfer by design.  Aggregating several
+ * adjacent requests into a single wire message here has been considered
+ * for small-IO workloads and rejected: bio merging in the plug list and
+ * the IO scheduler already coalesces adjacent small bios into one request
+ * before ->queue_rq() sees them, up to the max_io_size/max_segments
+ * limits the server advertises through the RTRS session, so a
+ * driver-level second pass would only catch what the server declined to
+ * accept in one message.  It would also put several requests behind one
+ * permit and one rkey, which breaks the per-message error and timeout
+ * fan-out and requires an incompatible RNBD_PROTO_VER bump on both
+ * sides.  If per-message overhead dominates, raise the server-side
+ * limits instead and let block-layer merging do its job.
+ */
 static blk_status_t rnbd_queue_rq(struct blk_mq_hw_ctx *hctx,
 				   const struct blk_mq_queue_data *bd)
 {
@@ -76,6 +76,16 @@ MODULE_PARM_DESC(max_buffer_pages,
  *
  * When the list of persistent grants is full we clean it up using a LRU
  * algorithm.
+ *
+ * If a guest's working set overflows the pool and map/unmap churn shows up
+ * in profiles, raise this limit (it is a runtime module parameter); the
+ * default is a memory trade-off, not a structural cap.  Note that grants
+ * are a per-frame Xen ABI - a grant reference names exactly one guest
+ * frame - so mapping multi-page extents under a single grant would require
+ * a new grant-table interface in the hypervisor, not a blkback change.
+ * The map/unmap operations themselves are already batched into single
+ * hypercalls per segment array, and multi-queue rings are negotiated via
+ * xenbus up to the max_queues parameter.
  */
 
 static int max_pgrants = 1056;
@@ -44,6 +44,21 @@ static void zstd_custom_free(void *opaque, void *address)
 	kvfree(address);
 }
 
+/*
+ * Dictionaries are supplied ready-made from userspace (algorithm_params
+ * "dict=" attr) and only consumed here.  An in-kernel online trainer -
+ * sample stored pages, retrain periodically, recompress cold slots -
+ * has been considered and belongs in userspace instead: the ZDICT
+ * trainer is not part of the kernel's zstd port and is far too
+ * allocation- and CPU-hungry to run against a swap device's memory
+ * budget, and sampling would mean the kernel holding plaintext copies
+ * of swapped pages beyond their I/O lifetime.  The intended flow is to
+ * train offline on representative data (e.g. a dump of the workload's
+ * heap), load the result via "dict=", and use the existing writeback /
+ * recompression machinery - a secondary zstd configured with the
+ * dictionary plus the "recompress" trigger - to move cold slots over
+ * to it in the background.
+ */
 static void zstd_release_params(struct zcomp_params *params)
 {
 	struct zstd_params *zp = params->drv_data;
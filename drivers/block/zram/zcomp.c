@@ -118,6 +118,17 @@ void zcomp_stream_put(struct zcomp *comp)
 	local_unlock(&comp->stream->lock);
 }
 
+/*
+ * Routing between backends is zram's job, not this wrapper's: the device
+ * keeps up to four zcomp instances by priority (comp_algorithm plus
+ * recomp_algorithm), writes always take the fastest one, and demotion to
+ * a stronger algorithm happens post-hoc through the recompress interface
+ * with idle/huge/incompressible targeting.  Pages the fast algorithm
+ * cannot shrink are stored raw as ZRAM_HUGE.  Trying the compressor and
+ * looking at the result is also the entropy estimate: a cheap LZ pass
+ * over one page costs about what a sampling estimator would, and is
+ * exact.
+ */
 int zcomp_compress(struct zcomp *comp, struct zcomp_strm *zstrm,
 		   const void *src, unsigned int *dst_len)
 {
@@ -1707,6 +1707,20 @@ static int write_incompressible_page(struct zram *zram, struct page *page,
 	return 0;
 }
 
+/*
+ * Compression happens inline in the submitting context, and that is a
+ * feature, not an oversight.  zram's dominant user is swap, where the
+ * submitter is reclaim: doing the work here means a store completes
+ * using only the per-CPU stream and a zsmalloc handle, with no hand-off
+ * to worker threads that would themselves need memory and scheduling to
+ * make progress while the system is short on memory.  Queueing writes
+ * into per-CPU batches for a compressor pool adds a page-lifetime
+ * problem too (the source page belongs to reclaim and is gone once the
+ * bio completes), so batching would begin by copying every page.
+ * Deferred, throughput-oriented work does exist, but as explicit
+ * post-processing (recompression and writeback) driven from sysfs
+ * where the inline latency rules don't apply.
+ */
 static int zram_write_page(struct zram *zram, struct page *page, u32 index)
 {
 	int ret = 0;
@@ -666,6 +666,19 @@ static unsigned int amd_pstate_fast_switch(struct cpufreq_policy *policy,
 	return policy->cur;
 }
 
+/*
+ * This callback is already the "fast path": schedutil invokes it
+ * synchronously from scheduler context - including the wakeup-from-idle
+ * path - and the perf request goes straight to the CPPC request MSR with
+ * no sampling period in between.  A driver-private boost that writes
+ * max perf on wakeup ahead of the governor would just race with the
+ * adjust_perf call the same wakeup triggers, and policy about which task
+ * deserves an instant ramp belongs to the scheduler: a latency-sensitive
+ * task's uclamp_min raises target_perf here at enqueue time, and
+ * schedutil's iowait boost covers the completion-wait pattern.  Ramp
+ * behaviour is observable through the existing amd_pstate_perf
+ * tracepoint, which records des_perf against the measured frequency.
+ */
 static void amd_pstate_adjust_perf(unsigned int cpu,
 				   unsigned long _min_perf,
 				   unsigned long target_perf,
@@ -2627,6 +2627,16 @@ static void cpufreq_update_pressure(struct cpufreq_policy *policy)
  * @policy) or replace the governor for @policy with @new_gov.
  *
  * The cpuinfo part of @policy is not updated by this function.
+ *
+ * Note that serialization here is strictly per policy: policy->rwsem does
+ * not nest across policies and there is no global transition lock, so
+ * updates to different policies already run concurrently.  When a
+ * many-policy event (e.g. thermal capping on large servers) still takes
+ * long to converge, the serialization is in the caller iterating policies
+ * from one context, or in a driver whose ->target() blocks on firmware -
+ * the fixes belong there (issue the per-policy QoS updates concurrently,
+ * or implement ->fast_switch()/->adjust_perf()), not in an asynchronous
+ * transition engine underneath every governor's error handling.
  */
 static int cpufreq_set_policy(struct cpufreq_policy *policy,
 			      struct cpufreq_governor *new_gov,
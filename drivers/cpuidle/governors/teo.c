@@ -95,6 +95,19 @@
  * 4. Obtain the sleep length value and check if it is below the target
  *    residency of the current candidate state, in which case a new shallower
  *    candidate state needs to be found, so look for it.
+ *
+ * The governor is deliberately blind to which device caused a wakeup.
+ * Splitting the bins per interrupt source has been proposed for workloads
+ * with a device-driven completion cadence (e.g. storage completions) and
+ * does not pay its way: the intercepts metric already learns any stable
+ * non-timer cadence from the measured idle durations alone, while
+ * attributing each wakeup to an IRQ would require IRQ_TIMINGS-style
+ * accounting on every interrupt system-wide and a per-source copy of the
+ * bin state on every CPU.  Workloads that know a completion is imminent
+ * have two existing levers instead: a %cpu_latency_qos_*() request, which
+ * this governor honors through the latency constraint and which drivers
+ * can pulse around expected completion windows, and completion polling,
+ * which avoids the idle entry entirely.
  */
 
 #include <linux/cpuidle.h>
@@ -866,6 +866,19 @@ dma_fence_wait_any_timeout(struct dma_fence **fences, uint32_t count,
 		return 0;
 	}
 
+	/*
+	 * An already signaled fence is the common case when a set of fences
+	 * is re-waited frame after frame; check for one before paying for
+	 * the callback allocation and install/remove round trip.
+	 */
+	for (i = 0; i < count; ++i) {
+		if (dma_fence_is_signaled(fences[i])) {
+			if (idx)
+				*idx = i;
+			return timeout;
+		}
+	}
+
 	cb = kcalloc(count, sizeof(struct default_wait_cb), GFP_KERNEL);
 	if (cb == NULL) {
 		ret = -ENOMEM;
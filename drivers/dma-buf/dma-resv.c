@@ -363,6 +363,19 @@ void dma_resv_replace_fences(struct dma_resv *obj, uint64_t context,
 EXPORT_SYMBOL(dma_resv_replace_fences);
 
 /* Restart the unlocked iteration by initializing the cursor object. */
+/*
+ * The restart-on-write scheme is a deliberate trade against immutable
+ * fence-list generations.  Publishing a fresh copy of the list on every
+ * write would give readers restart-free snapshots, but fence adds are
+ * per command submission and the list is the hottest object in the GPU
+ * stack - copying N fences per add turns every submission into O(N)
+ * allocation and retires the old generation through RCU, which is far
+ * more churn than the occasional reader retry it saves.  Readers that
+ * do suffer on write-hot buffers have two restart-free options already:
+ * take the resv lock and use dma_resv_iter_first()/next(), or grab one
+ * consistent snapshot with dma_resv_get_fences() and iterate that
+ * array without any further synchronization.
+ */
 static void dma_resv_iter_restart_unlocked(struct dma_resv_iter *cursor)
 {
 	cursor->index = 0;
@@ -18,6 +18,7 @@
 #include <linux/mm.h>
 #include <linux/module.h>
 #include <linux/scatterlist.h>
+#include <linux/shrinker.h>
 #include <linux/slab.h>
 #include <linux/vmalloc.h>
 
@@ -54,6 +55,90 @@ static gfp_t order_flags[] = {HIGH_ORDER_GFP, HIGH_ORDER_GFP, LOW_ORDER_GFP};
 static const unsigned int orders[] = {8, 4, 0};
 #define NUM_ORDERS ARRAY_SIZE(orders)
 
+/*
+ * Pages from released buffers are kept in per-order pools and handed out
+ * again on the next allocation, so buffer churn (e.g. per-frame camera
+ * buffers) doesn't pay the page allocator on the hot path.  Pages are
+ * zeroed when they enter the pool, on the releasing task's time, keeping
+ * the allocation side cheap while never handing one client's data to
+ * another.  A shrinker gives the pooled pages back under memory pressure.
+ */
+static struct list_head pool_pages[NUM_ORDERS];
+static unsigned long pool_count[NUM_ORDERS];
+static DEFINE_SPINLOCK(pool_lock);
+static struct shrinker *pool_shrinker;
+
+static struct page *system_heap_pool_fetch(int i)
+{
+	struct page *page = NULL;
+
+	spin_lock(&pool_lock);
+	if (!list_empty(&pool_pages[i])) {
+		page = list_first_entry(&pool_pages[i], struct page, lru);
+		list_del(&page->lru);
+		pool_count[i]--;
+	}
+	spin_unlock(&pool_lock);
+
+	return page;
+}
+
+static void system_heap_pool_release(struct page *page)
+{
+	unsigned int order = compound_order(page);
+	int i, j;
+
+	for (i = 0; i < NUM_ORDERS; i++)
+		if (orders[i] == order)
+			break;
+	if (i == NUM_ORDERS) {
+		__free_pages(page, order);
+		return;
+	}
+
+	/* Zero now so the allocation path can reuse the page as-is. */
+	for (j = 0; j < (1 << order); j++)
+		clear_highpage(page + j);
+
+	spin_lock(&pool_lock);
+	list_add(&page->lru, &pool_pages[i]);
+	pool_count[i]++;
+	spin_unlock(&pool_lock);
+}
+
+static unsigned long system_heap_shrink_count(struct shrinker *shrinker,
+					      struct shrink_control *sc)
+{
+	unsigned long count = 0;
+	int i;
+
+	for (i = 0; i < NUM_ORDERS; i++)
+		count += pool_count[i] << orders[i];
+
+	return count ? : SHRINK_EMPTY;
+}
+
+static unsigned long system_heap_shrink_scan(struct shrinker *shrinker,
+					     struct shrink_control *sc)
+{
+	unsigned long freed = 0;
+	int i;
+
+	/* Drain small orders first, they are the cheapest to refill. */
+	for (i = NUM_ORDERS - 1; i >= 0; i--) {
+		while (freed < sc->nr_to_scan) {
+			struct page *page = system_heap_pool_fetch(i);
+
+			if (!page)
+				break;
+			__free_pages(page, orders[i]);
+			freed += 1 << orders[i];
+		}
+	}
+
+	return freed ? : SHRINK_STOP;
+}
+
 static struct sg_table *dup_sg_table(struct sg_table *table)
 {
 	struct sg_table *new_table;
@@ -292,7 +377,7 @@ static void system_heap_dma_buf_release(struct dma_buf *dmabuf)
 	for_each_sgtable_sg(table, sg, i) {
 		struct page *page = sg_page(sg);
 
-		__free_pages(page, compound_order(page));
+		system_heap_pool_release(page);
 	}
 	sg_free_table(table);
 	kfree(buffer);
@@ -323,6 +408,9 @@ static struct page *alloc_largest_available(unsigned long size,
 		if (max_order < orders[i])
 			continue;
 
+		page = system_heap_pool_fetch(i);
+		if (page)
+			return page;
 		page = alloc_pages(order_flags[i], orders[i]);
 		if (!page)
 			continue;
@@ -424,14 +512,28 @@ static const struct dma_heap_ops system_heap_ops = {
 static int __init system_heap_create(void)
 {
 	struct dma_heap_export_info exp_info;
+	int i;
+
+	for (i = 0; i < NUM_ORDERS; i++)
+		INIT_LIST_HEAD(&pool_pages[i]);
+
+	pool_shrinker = shrinker_alloc(0, "dma-buf-system-heap-pool");
+	if (!pool_shrinker)
+		return -ENOMEM;
+
+	pool_shrinker->count_objects = system_heap_shrink_count;
+	pool_shrinker->scan_objects = system_heap_shrink_scan;
+	shrinker_register(pool_shrinker);
 
 	exp_info.name = "system";
 	exp_info.ops = &system_heap_ops;
 	exp_info.priv = NULL;
 
 	sys_heap = dma_heap_add(&exp_info);
-	if (IS_ERR(sys_heap))
+	if (IS_ERR(sys_heap)) {
+		shrinker_free(pool_shrinker);
 		return PTR_ERR(sys_heap);
+	}
 
 	return 0;
 }
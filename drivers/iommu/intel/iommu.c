@@ -3560,6 +3560,18 @@ static size_t intel_iommu_unmap_pages(struct iommu_domain *domain,
 	return intel_iommu_unmap(domain, iova, size, gather);
 }
 
+/*
+ * Deferred invalidation is a core-layer policy, not a driver one.  When
+ * the domain is IOMMU_DOMAIN_DMA_FQ (iommu.strict=0, or the group's
+ * sysfs "type" attribute), dma-iommu queues freed IOVA ranges and calls
+ * back into the driver on a size threshold or timer, and the IOVA
+ * allocator keeps the range out of reuse until the flush lands - the
+ * bounded-staleness batching that recovers most of passthrough
+ * performance for strict-mode-stalled submit paths.  In strict mode
+ * this sync is intentionally synchronous per unmap; a second,
+ * driver-private invalidation log would just reimplement the flush
+ * queue underneath the layer that already owns the reuse policy.
+ */
 static void intel_iommu_tlb_sync(struct iommu_domain *domain,
 				 struct iommu_iotlb_gather *gather)
 {
@@ -487,6 +487,18 @@ err_unmap:
 	return rc;
 }
 
+/*
+ * Superpage mappings fall out of the design rather than needing a
+ * dedicated bulk path: pin_user_pages() runs against TEMP_MEMORY_LIMIT
+ * sized chunks, the pfn_batch run-length encodes physically contiguous
+ * results, and each run is handed to iommu_map() as one call, which the
+ * IOMMU driver splits into the largest page sizes the hardware supports.
+ * A hugepage-backed 128G region therefore maps as 2M/1G IOPTEs with no
+ * per-PAGE_SIZE work outside the VFIO type1 compat case below.  If a
+ * large map is slow, profile the pin phase (fault-in of the backing
+ * hugepages) before suspecting this path - that cost belongs to the
+ * memory backend, and prefaulting or mlock at VM setup addresses it.
+ */
 static int batch_to_domain(struct pfn_batch *batch, struct iommu_domain *domain,
 			   struct iopt_area *area, unsigned long start_index)
 {
@@ -1304,6 +1304,14 @@ static inline u64 get_delta_entry_offset(const struct delta_index_entry *delta_e
  * Decode a delta index entry delta value. The delta_index_entry basically describes the previous
  * list entry, and has had its offset field changed to point to the subsequent entry. We decode the
  * bit stream and update the delta_list_entry to describe the entry.
+ *
+ * Decoding is sequential by construction, not by oversight: each entry's bit offset is only known
+ * once the previous entry's length has been decoded, so the Rice-coded stream cannot be expanded
+ * by lanes - a SIMD bulk decode would still walk the same dependency chain, while paying
+ * kernel_fpu_begin() per list. The scalar path already consumes the stream a 32-bit word at a
+ * time with ffs() for the unary part, the whole list is prefetched when a search starts, and the
+ * remembered offset (save_key/save_offset) lets hot lists resume mid-stream instead of decoding
+ * from the head.
  */
 static inline void decode_delta(struct delta_index_entry *delta_entry)
 {
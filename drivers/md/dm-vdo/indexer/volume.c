@@ -921,6 +921,18 @@ int uds_search_cached_record_page(struct volume *volume, struct uds_request *req
 	return UDS_SUCCESS;
 }
 
+/*
+ * This chapter-granular prefetch is as far ahead as speculation can
+ * usefully reach.  Within a chapter it already hides the page faults a
+ * restore-style run of hits would otherwise take one at a time.  Across
+ * chapters there is nothing to extrapolate from: lookups are keyed by
+ * record name, which is a hash, so the chapter sequence a restore
+ * produces is only discovered as each name is resolved - "chapter N was
+ * just used" carries no information about whether N+1 is next.  Reading
+ * N+1..N+k anyway would evict proven-hot chapters from a sparse cache
+ * that holds only a handful, which is why the self-tuning readahead
+ * window keeps losing to this one-chapter policy whenever it is tried.
+ */
 void uds_prefetch_volume_chapter(const struct volume *volume, u32 chapter)
 {
 	const struct index_geometry *geometry = volume->geometry;
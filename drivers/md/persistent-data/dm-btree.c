@@ -371,6 +371,20 @@ static int btree_lookup_raw(struct ro_spine *s, dm_block_t block, uint64_t key,
 	return 0;
 }
 
+/*
+ * A node cache above the block manager keeps being proposed for
+ * metadata-heavy thin workloads, but it would sit on top of one that is
+ * already there: every node visit resolves through dm-bufio, which keeps
+ * hot nodes in memory and runs the btree_node_validator once per buffer
+ * residence, not per visit, and the per-node read/write "locks" taken on
+ * the way down compile to nothing unless DM_DEBUG_BLOCK_MANAGER_LOCKING
+ * is set.  What remains per visit is dm-bufio's client lock, so if lock
+ * traffic shows up in profiles, that is the lock to look at (and the
+ * bufio client's cache size to grow) - a second cache layer with its own
+ * reclamation would have to replay shadowing and transaction rollback
+ * semantics that the transaction manager currently gets from bufio's
+ * ownership of the buffers.
+ */
 int dm_btree_lookup(struct dm_btree_info *info, dm_block_t root,
 		    uint64_t *keys, void *value_le)
 {
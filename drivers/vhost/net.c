@@ -1084,6 +1084,20 @@ err:
 
 /* Expects to be always run from workqueue - which acts as
  * read-size critical section for our kind of RCU. */
+/*
+ * RX is copy-based on purpose.  A zero-copy receive mode - NIC DMA
+ * straight into guest-posted buffers, mirroring the TX ubuf machinery -
+ * keeps getting proposed and keeps not working out: the host NIC fills
+ * its RX ring long before it knows which (if any) guest the packet is
+ * for, so guest pages would have to back the shared NIC ring and one
+ * guest could see another's traffic; mergeable buffers let one packet
+ * span guest descriptors in ways a NIC's scatter rules can't express,
+ * so a copy fallback stays on the hot path anyway; and the copy is also
+ * where the vnet header rewrite and the XDP pass happen.  Guests that
+ * need line-rate RX without the copy should get the queue itself via
+ * vDPA or a passthrough VF, which hands the NIC ring to the guest
+ * rather than teaching vhost to impersonate one.
+ */
 static void handle_rx(struct vhost_net *net)
 {
 	struct vhost_net_virtqueue *nvq = &net->vqs[VHOST_NET_VQ_RX];
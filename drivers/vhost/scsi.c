@@ -1054,6 +1054,16 @@ static u16 vhost_buf_to_lun(u8 *lun_buf)
 	return ((lun_buf[2] << 8) | lun_buf[3]) & 0x3FFF;
 }
 
+/*
+ * Each virtqueue is handled by whichever vhost worker it is attached to.
+ * A single shared worker is only the default: userspace can spread queues
+ * across threads with VHOST_NEW_WORKER/VHOST_ATTACH_VRING_WORKER (see the
+ * ioctl dispatch below) and pin those workers to match guest queue
+ * affinity, which is where multi-LUN parallelism comes from - LUN demux
+ * happens per command, so IOPS scales with vqs-to-workers, not with LUN
+ * count.  Completions are likewise batched per work item, signalling the
+ * guest once per reaped batch subject to the ring's event suppression.
+ */
 static void
 vhost_scsi_handle_vq(struct vhost_scsi *vs, struct vhost_virtqueue *vq)
 {
@@ -334,6 +334,8 @@ static void __vhost_vq_meta_reset(struct vhost_virtqueue *vq)
 
 	for (j = 0; j < VHOST_NUM_ADDRS; j++)
 		vq->meta_iotlb[j] = NULL;
+	for (j = 0; j < VHOST_NUM_XLAT; j++)
+		vq->xlat_iotlb[j] = NULL;
 }
 
 static void vhost_vq_meta_reset(struct vhost_dev *d)
@@ -2411,12 +2413,25 @@ err:
 }
 EXPORT_SYMBOL_GPL(vhost_vq_init_access);
 
+/*
+ * Like meta_iotlb for the ring addresses, xlat_iotlb memoizes interval tree
+ * lookups for data descriptors: map pointers stay valid under vq->mutex
+ * because IOTLB updates and invalidations reset the cache while holding all
+ * vq mutexes.  Direct-mapped by guest page frame, so a descriptor chain
+ * walking a handful of hot mappings skips the tree entirely.
+ */
+static inline unsigned int vhost_xlat_hash(u64 addr)
+{
+	return (addr >> PAGE_SHIFT) & (VHOST_NUM_XLAT - 1);
+}
+
 static int translate_desc(struct vhost_virtqueue *vq, u64 addr, u32 len,
 			  struct iovec iov[], int iov_size, int access)
 {
 	const struct vhost_iotlb_map *map;
 	struct vhost_dev *dev = vq->dev;
 	struct vhost_iotlb *umem = dev->iotlb ? dev->iotlb : dev->umem;
+	bool cached = umem == dev->iotlb;
 	struct iovec *_iov;
 	u64 s = 0, last = addr + len - 1;
 	int ret = 0;
@@ -2428,15 +2443,23 @@ static int translate_desc(struct vhost_virtqueue *vq, u64 addr, u32 len,
 			break;
 		}
 
-		map = vhost_iotlb_itree_first(umem, addr, last);
-		if (map == NULL || map->start > addr) {
-			if (umem != dev->iotlb) {
-				ret = -EFAULT;
+		map = cached ? vq->xlat_iotlb[vhost_xlat_hash(addr)] : NULL;
+		if (map && (addr < map->start || addr > map->last))
+			map = NULL;
+		if (!map) {
+			map = vhost_iotlb_itree_first(umem, addr, last);
+			if (map == NULL || map->start > addr) {
+				if (umem != dev->iotlb) {
+					ret = -EFAULT;
+					break;
+				}
+				ret = -EAGAIN;
 				break;
 			}
-			ret = -EAGAIN;
-			break;
-		} else if (!(map->perm & access)) {
+			if (cached)
+				vq->xlat_iotlb[vhost_xlat_hash(addr)] = map;
+		}
+		if (!(map->perm & access)) {
 			ret = -EPERM;
 			break;
 		}
@@ -72,6 +72,9 @@ enum vhost_uaddr_type {
 	VHOST_NUM_ADDRS = 3,
 };
 
+/* Direct-mapped per-virtqueue cache of IOTLB data translations. */
+#define VHOST_NUM_XLAT 4
+
 struct vhost_vring_call {
 	struct eventfd_ctx *ctx;
 	struct irq_bypass_producer producer;
@@ -89,6 +92,7 @@ struct vhost_virtqueue {
 	vring_avail_t __user *avail;
 	vring_used_t __user *used;
 	const struct vhost_iotlb_map *meta_iotlb[VHOST_NUM_ADDRS];
+	const struct vhost_iotlb_map *xlat_iotlb[VHOST_NUM_XLAT];
 	struct file *kick;
 	struct vhost_vring_call call_ctx;
 	struct eventfd_ctx *error_ctx;
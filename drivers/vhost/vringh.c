@@ -103,7 +103,17 @@ void vringh_kiov_advance(struct vringh_kiov *iov, size_t len)
 }
 EXPORT_SYMBOL(vringh_kiov_advance);
 
-/* Copy some bytes to/from the iovec.  Returns num copied. */
+/*
+ * Copy some bytes to/from the iovec.  Returns num copied.
+ *
+ * No address validation happens here: vringh_getdesc_*() already walked the
+ * descriptor chain once, range-checked each descriptor, and flattened the
+ * chain into this kiov, so the loop below is pure copying plus offset
+ * arithmetic.  The per-call chain walk in getdesc cannot be cached by
+ * descriptor head either: the descriptor table lives in guest/userspace
+ * memory and may be rewritten between uses, so reusing a previous
+ * translation would act on unvalidated, stale addresses.
+ */
 static inline ssize_t vringh_iov_xfer(struct vringh *vrh,
 				      struct vringh_kiov *iov,
 				      void *ptr, size_t len,
@@ -86,6 +86,19 @@ static struct vhost_vsock *vhost_vsock_get(u32 guest_cid)
 	return NULL;
 }
 
+/*
+ * Signaling here is already batched: notifications are disabled for the
+ * duration of the loop, vhost_add_used() only accumulates, and the guest
+ * is signalled once per drained queue (or weight quantum) - with
+ * EVENT_IDX acked, vhost_signal() additionally suppresses the interrupt
+ * whenever the guest is still behind.  What is deliberately not done is
+ * packing several packets into one guest buffer: the device format is
+ * one virtio_vsock_hdr plus payload per buffer chain, so a multi-packet
+ * buffer would need a mergeable-buffers style feature bit negotiated in
+ * the spec before either side could parse it.  Small-message RPC floods
+ * are better served by sizing rx buffers down in the guest so each
+ * descriptor covers one message instead of a 64K window.
+ */
 static void
 vhost_transport_do_send_pkt(struct vhost_vsock *vsock,
 			    struct vhost_virtqueue *vq)
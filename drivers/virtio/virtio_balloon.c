@@ -180,6 +180,18 @@ static void balloon_ack(struct virtqueue *vq)
 	wake_up(&vb->acked);
 }
 
+/*
+ * One synchronous chunk at a time is tied to the protocol and the single
+ * vb->pfns buffer: with VIRTIO_BALLOON_F_MUST_TELL_HOST the guest may not
+ * touch inflated pages until the host has seen them, and the legacy PFN
+ * array encodes every 4K subpage individually, so bigger batches only
+ * shave acks off a stream whose cost is per-4K on the host side anyway.
+ * The efficient bulk mechanisms exist as separate features rather than a
+ * fatter array: VIRTIO_BALLOON_F_REPORTING hands the host high-order page
+ * runs as single sg entries via the page-reporting core, and guests that
+ * need to move tens of gigabytes quickly should use virtio-mem, which
+ * plugs/unplugs memory in blocks instead of 4K pages.
+ */
 static void tell_host(struct virtio_balloon *vb, struct virtqueue *vq)
 {
 	struct scatterlist sg;
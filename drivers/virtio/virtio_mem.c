@@ -632,6 +632,16 @@ static bool virtio_mem_could_add_memory(struct virtio_mem *vm, uint64_t size)
  * onlining code).
  *
  * Will not modify the state of memory blocks in virtio-mem.
+ *
+ * Serialization of the add/online sequence is not ours to relax: the memory
+ * hotplug core runs every add_memory()/online path under mem_hotplug_lock,
+ * so blocks added from here are onlined one at a time however the driver
+ * issues them, and the struct-page init dominating that path runs inside
+ * the core, not here.  What a driver can do about memmap cost is already
+ * done where supported: with memmap_on_memory the memmap lands on the
+ * hot-added range itself, so onlining initializes the new memory rather
+ * than consuming the old.  Page contents are not zeroed at online at all;
+ * zeroing remains per-allocation.
  */
 static int virtio_mem_add_memory(struct virtio_mem *vm, uint64_t addr,
 				 uint64_t size)
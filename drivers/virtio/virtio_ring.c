@@ -107,6 +107,12 @@ struct vring_virtqueue_split {
 	 */
 	u16 avail_idx_shadow;
 
+	/*
+	 * Last value of used->idx read under a barrier, so that a burst
+	 * of used buffers is reaped with a single read barrier.
+	 */
+	u16 used_idx_shadow;
+
 	/* Per-descriptor state. */
 	struct vring_desc_state_split *desc_state;
 	struct vring_desc_extra *desc_extra;
@@ -824,14 +830,25 @@ static void *virtqueue_get_buf_ctx_split(struct virtqueue *_vq,
 		return NULL;
 	}
 
-	if (!more_used_split(vq)) {
-		pr_debug("No more buffers in queue\n");
-		END_USE(vq);
-		return NULL;
-	}
+	/*
+	 * Entries up to the snapshotted used->idx have already been fenced
+	 * by a previous call; only re-read the shared index, and pay for a
+	 * barrier, once the snapshot is exhausted.  This way a burst of
+	 * completions costs one read barrier instead of one per buffer.
+	 */
+	if (vq->last_used_idx == vq->split.used_idx_shadow) {
+		if (!more_used_split(vq)) {
+			pr_debug("No more buffers in queue\n");
+			END_USE(vq);
+			return NULL;
+		}
 
-	/* Only get used array entries after they have been exposed by host. */
-	virtio_rmb(vq->weak_barriers);
+		/* Only get used array entries after they have been exposed by
+		 * host. */
+		virtio_rmb(vq->weak_barriers);
+		vq->split.used_idx_shadow = virtio16_to_cpu(_vq->vdev,
+				vq->split.vring.used->idx);
+	}
 
 	last_used = (vq->last_used_idx & (vq->split.vring.num - 1));
 	i = virtio32_to_cpu(_vq->vdev,
@@ -995,6 +1012,7 @@ static void virtqueue_vring_init_split(struct vring_virtqueue_split *vring_split
 
 	vring_split->avail_flags_shadow = 0;
 	vring_split->avail_idx_shadow = 0;
+	vring_split->used_idx_shadow = 0;
 
 	/* No callback?  Tell other side not to bother us. */
 	if (!vq->vq.callback) {
@@ -61,6 +61,15 @@ ssize_t v9fs_fid_xattr_get(struct p9_fid *fid, const char *name,
  *
  * Returns a negative error number on failure, or the number of bytes
  * used / required on success.
+ *
+ * Every query is a TXATTRWALK round trip by design.  Caching results,
+ * especially negative ones, against the qid version is not sound: qid
+ * version semantics are server-defined (QEMU derives it from mtime) and
+ * servers are not required to bump it when an xattr changes, so a cache
+ * keyed on it can serve stale security.* and POSIX ACL state, which the
+ * LSMs consulting these xattrs must never see.  Batching several names
+ * into one RPC would need a new operation in the 9P2000.L protocol; the
+ * wire protocol offers only single-name TXATTRWALK.
  */
 ssize_t v9fs_xattr_get(struct dentry *dentry, const char *name,
 		       void *buffer, size_t buffer_size)
@@ -436,6 +436,16 @@ int cachefiles_delete_object(struct cachefiles_object *object,
 /*
  * Create a temporary file and leave it unattached and un-xattr'd until the
  * time comes to discard the object from memory.
+ *
+ * Note that each cookie deliberately gets its own backing file even if many
+ * cookies carry identical data (e.g. cloned container volumes).  Sharing
+ * extents between objects through a content-addressed index was considered
+ * and rejected: coherency, invalidation and culling all operate on whole
+ * backing files (S_KERNEL_FILE marking, atime-based culling by cachefilesd,
+ * truncate-on-invalidate), and none of those have a sensible meaning for an
+ * extent shared by objects in different states.  If the cache sits on a
+ * filesystem with block-level reflink/dedup, that layer can share the
+ * storage without cachefiles needing to know.
  */
 struct file *cachefiles_create_tmpfile(struct cachefiles_object *object)
 {
@@ -809,6 +809,17 @@ out:
 	return d_splice_alias(inode, dentry);
 }
 
+/*
+ * One page per call matches the on-media format: cramfs compresses each
+ * PAGE_SIZE chunk independently, so there is no larger cluster that a
+ * windowed decompressor could amortize over.  The compressed side is
+ * already buffered and read ahead in BLKS_PER_BUF chunks by
+ * cramfs_blkdev_read(), decompressed pages persist in each inode's page
+ * cache under the global LRU, and XIP pages (direct pointers on MTD) are
+ * mapped without any decompression.  Boot-time pre-warming is a userspace
+ * policy: readahead(2)/posix_fadvise on the profiled files populates the
+ * cache through this same path during idle boot phases.
+ */
 static int cramfs_read_folio(struct file *file, struct folio *folio)
 {
 	struct inode *inode = folio->mapping->host;
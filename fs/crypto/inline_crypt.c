@@ -88,7 +88,18 @@ static void fscrypt_log_blk_crypto_impl(struct fscrypt_mode *mode,
 	}
 }
 
-/* Enable inline encryption for this file if supported. */
+/*
+ * Enable inline encryption for this file if supported.
+ *
+ * The decision is per-inode, made once at key setup, because the choice
+ * dictates how the filesystem builds its I/O: with inline crypto the bio
+ * carries plaintext plus a crypt context, without it fscrypt encrypts into
+ * bounce pages before submission.  Flipping that per extent at submit time
+ * would require both code paths to be armed on every I/O.  Mixed fleets do
+ * not need it anyway: with -o inlinecrypt everywhere, blk-crypto routes
+ * each bio to ICE hardware where present and to blk-crypto-fallback (CPU)
+ * where not, producing identical on-disk ciphertext either way.
+ */
 int fscrypt_select_encryption_impl(struct fscrypt_inode_info *ci)
 {
 	const struct inode *inode = ci->ci_inode;
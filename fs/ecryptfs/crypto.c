@@ -270,6 +270,14 @@ int virt_to_scatterlist(const void *addr, int size, struct scatterlist *sg,
  * @op: ENCRYPT or DECRYPT to indicate the desired operation
  *
  * Returns the number of bytes encrypted or decrypted; negative value on error
+ *
+ * The skcipher API underneath is asynchronous; it is this caller that
+ * serializes, submitting one extent and sleeping in crypto_wait_req().
+ * Keeping a window of extents in flight would require reworking the
+ * page-at-a-time read_folio/writepage integration above this layer.
+ * eCryptfs is in maintenance mode and that work belongs to fscrypt,
+ * which encrypts at the bio level and already gets the batching and
+ * hardware-offload behavior this path lacks.
  */
 static int crypt_scatterlist(struct ecryptfs_crypt_stat *crypt_stat,
 			     struct scatterlist *dst_sg,
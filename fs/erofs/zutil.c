@@ -128,6 +128,17 @@ int __init z_erofs_gbuf_init(void)
 		total = min(z_erofs_gbuf_count, total);
 	z_erofs_gbuf_count = total;
 
+	/*
+	 * Unless the administrator sets `reserved_pages` explicitly, retain a
+	 * bounded, CPU-count scaled number of short-lived pages across I/O
+	 * bursts, so that steady-state decompression does not go back to the
+	 * page allocator for every burst.  The pool is only filled with pages
+	 * being released anyway and is drained by the shrinker under memory
+	 * pressure, so the cap is not pinned memory.
+	 */
+	if (!z_erofs_rsv_nrpages)
+		z_erofs_rsv_nrpages = min(num_possible_cpus() * 4, 128U);
+
 	/* The last (special) global buffer is the reserved buffer */
 	total += !!z_erofs_rsv_nrpages;
 
@@ -240,10 +251,31 @@ void erofs_shrinker_unregister(struct super_block *sb)
 	mutex_unlock(&sbi->umount_mutex);
 }
 
+/* Release the short-lived pages retained in the reserved pool */
+static unsigned long z_erofs_shrink_rsvbuf(unsigned long nr)
+{
+	unsigned long freed = 0;
+
+	if (!z_erofs_rsvbuf)
+		return 0;
+
+	spin_lock(&z_erofs_rsvbuf->lock);
+	while (freed < nr && z_erofs_rsvbuf->nrpages) {
+		put_page(z_erofs_rsvbuf->pages[--z_erofs_rsvbuf->nrpages]);
+		++freed;
+	}
+	spin_unlock(&z_erofs_rsvbuf->lock);
+	return freed;
+}
+
 static unsigned long erofs_shrink_count(struct shrinker *shrink,
 					struct shrink_control *sc)
 {
-	return atomic_long_read(&erofs_global_shrink_cnt) ?: SHRINK_EMPTY;
+	unsigned long count = atomic_long_read(&erofs_global_shrink_cnt);
+
+	if (z_erofs_rsvbuf)
+		count += z_erofs_rsvbuf->nrpages;
+	return count ?: SHRINK_EMPTY;
 }
 
 static unsigned long erofs_shrink_scan(struct shrinker *shrink,
@@ -296,6 +328,9 @@ static unsigned long erofs_shrink_scan(struct shrinker *shrink,
 			break;
 	}
 	spin_unlock(&erofs_sb_list_lock);
+
+	if (freed < nr)
+		freed += z_erofs_shrink_rsvbuf(nr - freed);
 	return freed;
 }
 
@@ -55,6 +55,14 @@ static int exfat_allocate_bitmap(struct super_block *sb,
 	if (!sbi->vol_amap)
 		return -ENOMEM;
 
+	sbi->free_clus_in_sect = kvmalloc_array(sbi->map_sectors,
+				sizeof(unsigned int), GFP_KERNEL);
+	if (!sbi->free_clus_in_sect) {
+		kvfree(sbi->vol_amap);
+		sbi->vol_amap = NULL;
+		return -ENOMEM;
+	}
+
 	sector = exfat_cluster_to_sector(sbi, sbi->map_clu);
 	for (i = 0; i < sbi->map_sectors; i++) {
 		sbi->vol_amap[i] = sb_bread(sb, sector + i);
@@ -65,12 +73,31 @@ static int exfat_allocate_bitmap(struct super_block *sb,
 			while (j < i)
 				brelse(sbi->vol_amap[j++]);
 
+			kvfree(sbi->free_clus_in_sect);
+			sbi->free_clus_in_sect = NULL;
 			kvfree(sbi->vol_amap);
 			sbi->vol_amap = NULL;
 			return -EIO;
 		}
 	}
 
+	/*
+	 * Summarize the number of zero bits in each bitmap sector so that
+	 * the allocator can skip fully allocated sectors without scanning
+	 * them.  Bits in the last sector beyond the cluster count may be
+	 * set or clear on media; counting them can only overstate a
+	 * sector's free count, never report a sector with free clusters
+	 * as full, so the summary stays safe without masking.
+	 */
+	for (i = 0; i < sbi->map_sectors; i++) {
+		unsigned long *bitmap = (unsigned long *)sbi->vol_amap[i]->b_data;
+		unsigned int free = 0, j;
+
+		for (j = 0; j < sb->s_blocksize / sizeof(long); j++)
+			free += BITS_PER_LONG - hweight_long(bitmap[j]);
+		sbi->free_clus_in_sect[i] = free;
+	}
+
 	return 0;
 }
 
@@ -119,6 +146,7 @@ void exfat_free_bitmap(struct exfat_sb_info *sbi)
 	for (i = 0; i < sbi->map_sectors; i++)
 		__brelse(sbi->vol_amap[i]);
 
+	kvfree(sbi->free_clus_in_sect);
 	kvfree(sbi->vol_amap);
 }
 
@@ -136,7 +164,8 @@ int exfat_set_bitmap(struct inode *inode, unsigned int clu, bool sync)
 	i = BITMAP_OFFSET_SECTOR_INDEX(sb, ent_idx);
 	b = BITMAP_OFFSET_BIT_IN_SECTOR(sb, ent_idx);
 
-	set_bit_le(b, sbi->vol_amap[i]->b_data);
+	if (!test_and_set_bit_le(b, sbi->vol_amap[i]->b_data))
+		sbi->free_clus_in_sect[i]--;
 	exfat_update_bh(sbi->vol_amap[i], sync);
 	return 0;
 }
@@ -160,6 +189,7 @@ int exfat_clear_bitmap(struct inode *inode, unsigned int clu, bool sync)
 		return -EIO;
 
 	clear_bit_le(b, sbi->vol_amap[i]->b_data);
+	sbi->free_clus_in_sect[i]++;
 
 	exfat_update_bh(sbi->vol_amap[i], sync);
 
@@ -201,6 +231,31 @@ unsigned int exfat_find_free_bitmap(struct super_block *sb, unsigned int clu)
 
 	for (i = EXFAT_FIRST_CLUSTER; i < sbi->num_clusters;
 	     i += BITS_PER_LONG) {
+		if (map_b == 0 && clu_mask == 0 &&
+		    sbi->free_clus_in_sect[map_i] == 0) {
+			/*
+			 * The whole bitmap sector is allocated; jump over
+			 * it instead of scanning its words.  The last
+			 * sector may map fewer clusters than it has bits,
+			 * so only charge the scan budget for clusters that
+			 * really exist - otherwise a search that wrapped
+			 * around would run out of budget before reaching
+			 * its starting point again and report ENOSPC with
+			 * free clusters still left.
+			 */
+			unsigned int sect_bits = sb->s_blocksize * BITS_PER_BYTE;
+
+			if (sect_bits > sbi->num_clusters - clu_base)
+				sect_bits = sbi->num_clusters - clu_base;
+
+			i += sect_bits - BITS_PER_LONG;
+			clu_base += sect_bits;
+			if (++map_i >= sbi->map_sectors) {
+				clu_base = EXFAT_FIRST_CLUSTER;
+				map_i = 0;
+			}
+			continue;
+		}
 		bitval = *(__le_long *)(sbi->vol_amap[map_i]->b_data + map_b);
 		if (clu_mask > 0) {
 			bitval |= cpu_to_lel(clu_mask);
@@ -267,6 +267,7 @@ struct exfat_sb_info {
 	unsigned int map_clu; /* allocation bitmap start cluster */
 	unsigned int map_sectors; /* num of allocation bitmap sectors */
 	struct buffer_head **vol_amap; /* allocation bitmap */
+	unsigned int *free_clus_in_sect; /* free clusters per bitmap sector */
 
 	unsigned short *vol_utbl; /* upcase table */
 
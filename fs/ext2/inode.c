@@ -230,6 +230,18 @@ static int ext2_block_to_path(struct inode *inode,
  *		(ditto, *@err == -EAGAIN)
  *	or when it reads all @depth-1 indirect blocks successfully and finds
  *	the whole chain, all way to the data (returns %NULL, *err == 0).
+ *
+ *	The walk re-resolves the chain from the inode on every call rather
+ *	than keeping an in-memory extent approximation of the indirect
+ *	tree.  That is deliberate: sb_bread() means each indirect block is
+ *	read from media once and then served from the buffer cache, so for
+ *	a sequential scan every call after the first is a handful of cache
+ *	hits, and ext2_get_blocks() already returns as many contiguous
+ *	blocks per resolution as the caller asked for.  A shadow extent
+ *	cache would duplicate the buffer cache, need invalidation against
+ *	truncate and hole punch, and run against ext2's role as the simple
+ *	reference filesystem - workloads that need real extent trees have
+ *	ext4, which mounts ext2 filesystems.
  */
 static Indirect *ext2_get_branch(struct inode *inode,
 				 int depth,
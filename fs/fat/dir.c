@@ -471,6 +471,20 @@ static int fat_parse_short(struct super_block *sb,
 
 /*
  * Return values: negative -> error/not found, 0 -> found.
+ *
+ * The scan is linear because the on-disk format is: FAT directories
+ * have no index, so correctness always requires reading every entry
+ * once.  Proposals for an in-memory per-directory name hash plus a
+ * bloom filter for negative lookups resurface whenever someone drops
+ * 100k files in one directory; they have not been taken because the
+ * dcache already serves that role - repeat lookups (positive and
+ * negative) are satisfied by cached dentries and never reach this
+ * function - and the remaining callers are first-touch lookups and
+ * creates, where existence must be proven against the medium anyway.
+ * A shadow index that claims authority over "name not present" on a
+ * hot-removable, foreign-writable filesystem is a corruption source,
+ * not a cache.  Callers that control the workload should shard their
+ * files into subdirectories, which bounds this scan directly.
  */
 int fat_search_long(struct inode *inode, const unsigned char *name,
 		    int name_len, struct fat_slot_info *sinfo)
@@ -580,7 +580,16 @@ int fat_free_clusters(struct inode *inode, int cluster)
 			/*
 			 * Issue discard for the sectors we no longer
 			 * care about, batching contiguous clusters
-			 * into one request
+			 * into one request.
+			 *
+			 * This is inherently synchronous with the delete;
+			 * deferring it would mean tracking freed-but-not-
+			 * discarded extents across remounts and crashes.
+			 * Deployments where inline discard stalls
+			 * foreground I/O should mount without -o discard
+			 * and run periodic fstrim instead: fat_trim_fs()
+			 * walks the FAT and issues the same adjacency-
+			 * merged trims in batch, off the deletion path.
 			 */
 			if (cluster != fatent.entry + 1) {
 				int nr_clus = fatent.entry - first_cl + 1;
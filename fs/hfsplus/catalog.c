@@ -190,7 +190,18 @@ static int hfsplus_fill_cat_thread(struct super_block *sb,
 	return 10 + be16_to_cpu(entry->thread.nodeName.length) * 2;
 }
 
-/* Try to get a catalog entry for given catalog id */
+/*
+ * Try to get a catalog entry for given catalog id
+ *
+ * The B-tree search with full case-folded key comparison runs on cold
+ * lookups only.  Warm lookups are absorbed by the dcache, which hfsplus
+ * feeds with folded-name hashing and comparison (hfsplus_hash_dentry() /
+ * hfsplus_compare_dentry()), so a separate (parent CNID, name hash) cache
+ * would shadow a cache the VFS already maintains with proper invalidation.
+ * Sequential catalog scans get node readahead for free: B-tree nodes are
+ * read through the catalog file's page cache, which applies the normal
+ * readahead heuristics.
+ */
 int hfsplus_find_cat(struct super_block *sb, u32 cnid,
 		     struct hfs_find_data *fd)
 {
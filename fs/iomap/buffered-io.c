@@ -178,6 +178,41 @@ static void iomap_set_range_dirty(struct folio *folio, size_t off, size_t len)
 		ifs_set_range_dirty(folio, ifs, off, len);
 }
 
+/*
+ * Mark a freshly written range uptodate and dirty in a single pass.
+ *
+ * This is the per-folio tail of iomap_write_iter(); doing both bitmap
+ * updates under one state_lock acquisition instead of two is measurable
+ * for streaming writes with small blocks in large folios.
+ */
+static void iomap_set_range_uptodate_dirty(struct folio *folio,
+		size_t off, size_t len, size_t dirty_len)
+{
+	struct iomap_folio_state *ifs = folio->private;
+	unsigned long flags;
+	bool uptodate = true;
+
+	if (ifs) {
+		struct inode *inode = folio->mapping->host;
+		unsigned int blks_per_folio = i_blocks_per_folio(inode, folio);
+		unsigned int first_blk = off >> inode->i_blkbits;
+		unsigned int last_blk = (off + len - 1) >> inode->i_blkbits;
+		unsigned int last_dirty_blk =
+			(off + dirty_len - 1) >> inode->i_blkbits;
+
+		spin_lock_irqsave(&ifs->state_lock, flags);
+		bitmap_set(ifs->state, first_blk, last_blk - first_blk + 1);
+		if (dirty_len)
+			bitmap_set(ifs->state, first_blk + blks_per_folio,
+				   last_dirty_blk - first_blk + 1);
+		uptodate = ifs_is_fully_uptodate(folio, ifs);
+		spin_unlock_irqrestore(&ifs->state_lock, flags);
+	}
+
+	if (uptodate)
+		folio_mark_uptodate(folio);
+}
+
 static struct iomap_folio_state *ifs_alloc(struct inode *inode,
 		struct folio *folio, unsigned int flags)
 {
@@ -858,8 +893,8 @@ static bool __iomap_write_end(struct inode *inode, loff_t pos, size_t len,
 	 */
 	if (unlikely(copied < len && !folio_test_uptodate(folio)))
 		return false;
-	iomap_set_range_uptodate(folio, offset_in_folio(folio, pos), len);
-	iomap_set_range_dirty(folio, offset_in_folio(folio, pos), copied);
+	iomap_set_range_uptodate_dirty(folio, offset_in_folio(folio, pos), len,
+			copied);
 	filemap_dirty_folio(inode->i_mapping, folio);
 	return true;
 }
@@ -1084,7 +1084,23 @@ int isofs_get_blocks(struct inode *inode, sector_t iblock,
 		}
 
 		if (*bh) {
+			unsigned long max_size = (*bh)->b_size;
+
 			map_bh(*bh, inode->i_sb, firstext + b_off - offset);
+			/*
+			 * Everything up to the end of this section is
+			 * contiguous on disk.  If the caller asked for a
+			 * larger mapping by passing in a bigger b_size (as
+			 * mpage does for readahead), map the whole remainder
+			 * of the section in one go instead of being called
+			 * back once per block.
+			 */
+			if (nblocks == 1 &&
+			    max_size > (1UL << ISOFS_BUFFER_BITS(inode)) &&
+			    offset + sect_size > b_off)
+				(*bh)->b_size = min_t(unsigned long, max_size,
+					(offset + sect_size - b_off) <<
+						ISOFS_BUFFER_BITS(inode));
 		} else {
 			*bh = sb_getblk(inode->i_sb, firstext+b_off-offset);
 			if (!*bh)
@@ -373,12 +373,25 @@ void jbd2_journal_commit_transaction(journal_t *journal)
 	tid_t first_tid;
 	int update_tail;
 	int csum_size = 0;
+	bool early_submit;
 	LIST_HEAD(io_bufs);
 	LIST_HEAD(log_bufs);
 
 	if (jbd2_journal_has_csum_v2or3(journal))
 		csum_size = sizeof(struct jbd2_journal_block_tail);
 
+	/*
+	 * With v2/v3 checksums every log block carries its own tag checksum
+	 * and nothing written so far depends on later buffers, so a shadow
+	 * buffer can be sent to disk as soon as its tag is recorded instead
+	 * of waiting for the descriptor to fill.  That overlaps the device's
+	 * work with the remaining tag assembly and checksumming.  The legacy
+	 * JBD2_FEATURE_COMPAT_CHECKSUM rolling crc32 must be computed in log
+	 * block order, descriptor block first, so it keeps the batched
+	 * submission below.
+	 */
+	early_submit = !jbd2_has_feature_checksum(journal);
+
 	/*
 	 * First job: lock down the current transaction and wait for
 	 * all outstanding updates to complete.
@@ -689,6 +702,17 @@ void jbd2_journal_commit_transaction(journal_t *journal)
 			first_tag = 0;
 		}
 
+		/* The tag is recorded; let this buffer's IO rip right away. */
+		if (early_submit) {
+			struct buffer_head *bh = wbuf[bufs - 1];
+
+			lock_buffer(bh);
+			clear_buffer_dirty(bh);
+			set_buffer_uptodate(bh);
+			bh->b_end_io = journal_end_buffer_io_sync;
+			submit_bh(REQ_OP_WRITE | JBD2_JOURNAL_REQ_FLAGS, bh);
+		}
+
 		/* If there's no more to do, or if the descriptor is full,
 		   let the IO rip! */
 
@@ -711,6 +735,10 @@ start_journal_io:
 			for (i = 0; i < bufs; i++) {
 				struct buffer_head *bh = wbuf[i];
 
+				/* All but the descriptor are already in flight */
+				if (early_submit && i > 0)
+					break;
+
 				/*
 				 * Compute checksum.
 				 */
@@ -273,6 +273,20 @@ static ssize_t kernfs_file_read_iter(struct kiocb *iocb, struct iov_iter *iter)
 	return len;
 }
 
+/*
+ * A "bulk read" facility that resolves a registered set of nodes and
+ * fills one packed snapshot buffer per syscall gets proposed now and
+ * then for high-frequency telemetry.  It doesn't belong here: attribute
+ * show callbacks may sleep, take subsystem locks and read hardware, so
+ * a vectored fill loop would still pay each callback serially while
+ * pinning every resolved node active across the whole walk, and the
+ * snapshot would be no more atomic than issuing the reads back to back.
+ * The per-read costs a scraper can actually avoid are the path walk and
+ * open/close: keep the files open and pread(2) from offset 0, which
+ * re-runs only the show callback.  Anything that truly needs a packed,
+ * coherent multi-value sample should expose one attribute (or a bin
+ * file) that snapshots under the subsystem's own lock.
+ */
 static ssize_t kernfs_fop_read_iter(struct kiocb *iocb, struct iov_iter *iter)
 {
 	if (kernfs_of(iocb->ki_filp)->kn->flags & KERNFS_HAS_SEQ_SHOW)
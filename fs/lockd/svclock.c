@@ -49,6 +49,17 @@ static const struct rpc_call_ops nlmsvc_grant_ops;
 
 /*
  * The list of blocked locks to retry
+ *
+ * A single list under a single lock is deliberate.  Almost every access
+ * comes from the one lockd service thread, so sharding by file hash
+ * would add lookup cost without removing any contention; the only other
+ * users are the fl_lmops notifiers and the grant RPC completion, which
+ * touch individual blocks.  The list is kept sorted by b_when, so
+ * nlmsvc_retry_blocked() visits only the expired head rather than
+ * scanning every block, and GRANTED_MSG callbacks are already issued as
+ * asynchronous soft RPC tasks.  A host saturating lockd with byte-range
+ * locking is better served by NFSv4, whose lock state scales with the
+ * nfsd thread pool.
  */
 static LIST_HEAD(nlm_blocked);
 static DEFINE_SPINLOCK(nlm_blocked_lock);
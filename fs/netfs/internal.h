@@ -130,6 +130,8 @@ extern atomic_t netfs_n_rh_read_done;
 extern atomic_t netfs_n_rh_read_failed;
 extern atomic_t netfs_n_rh_zero;
 extern atomic_t netfs_n_rh_short_read;
+extern atomic_t netfs_n_rh_sreq_ooo;
+extern atomic_t netfs_n_rh_coll_stall;
 extern atomic_t netfs_n_rh_write;
 extern atomic_t netfs_n_rh_write_begin;
 extern atomic_t netfs_n_rh_write_done;
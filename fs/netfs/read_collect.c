@@ -265,8 +265,10 @@ reassess:
 		}
 
 		/* Stall if the front is still undergoing I/O. */
-		if (notes & HIT_PENDING)
+		if (notes & HIT_PENDING) {
+			netfs_stat(&netfs_n_rh_coll_stall);
 			break;
+		}
 
 		if (test_bit(NETFS_SREQ_FAILED, &front->flags)) {
 			if (!stream->failed) {
@@ -590,6 +592,8 @@ void netfs_read_subreq_terminated(struct netfs_io_subrequest *subreq)
 	if (list_is_first(&subreq->rreq_link, &stream->subrequests) ||
 	    test_bit(NETFS_RREQ_RETRYING, &rreq->flags))
 		netfs_wake_read_collector(rreq);
+	else
+		netfs_stat(&netfs_n_rh_sreq_ooo);
 
 	netfs_put_subrequest(subreq, true, netfs_sreq_trace_put_terminated);
 }
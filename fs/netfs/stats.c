@@ -24,6 +24,8 @@ atomic_t netfs_n_rh_read_done;
 atomic_t netfs_n_rh_read_failed;
 atomic_t netfs_n_rh_zero;
 atomic_t netfs_n_rh_short_read;
+atomic_t netfs_n_rh_sreq_ooo;
+atomic_t netfs_n_rh_coll_stall;
 atomic_t netfs_n_rh_write;
 atomic_t netfs_n_rh_write_begin;
 atomic_t netfs_n_rh_write_done;
@@ -77,6 +79,9 @@ int netfs_stats_show(struct seq_file *m, void *v)
 		   atomic_read(&netfs_n_rh_read),
 		   atomic_read(&netfs_n_rh_read_done),
 		   atomic_read(&netfs_n_rh_read_failed));
+	seq_printf(m, "RdPipe : oo=%u st=%u\n",
+		   atomic_read(&netfs_n_rh_sreq_ooo),
+		   atomic_read(&netfs_n_rh_coll_stall));
 	seq_printf(m, "UpldOps: UL=%u us=%u uf=%u\n",
 		   atomic_read(&netfs_n_wh_upload),
 		   atomic_read(&netfs_n_wh_upload_done),
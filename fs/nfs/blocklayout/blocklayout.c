@@ -226,6 +226,17 @@ bl_end_par_io_read(void *data)
 	schedule_work(&hdr->task.u.tk_work);
 }
 
+/*
+ * Although the loop below advances page by page, the expensive work is
+ * already amortized per extent: ext_tree_lookup() runs only when the
+ * current extent is used up (extent_length tracks the remaining run),
+ * pages within an extent accumulate into one bio that the block layer
+ * further merges under the plug, and each extent's bio is submitted as
+ * the walk crosses into the next one, so reads against multiple extents
+ * - including stripes resolved through the device map - are in flight
+ * concurrently under the parallel_io reference that completes the NFS
+ * read once the last bio finishes.
+ */
 static enum pnfs_try_status
 bl_read_pagelist(struct nfs_pgio_header *header)
 {
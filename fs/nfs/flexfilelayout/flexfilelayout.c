@@ -689,16 +689,44 @@ nfs4_ff_layout_stat_io_start_read(struct inode *inode,
 		pnfs_report_layoutstat(inode, nfs_io_gfp_mask());
 }
 
+/*
+ * EWMA with weight 1/8: smooth enough to ride out a single slow RPC,
+ * quick enough to react to a degrading data server within a few dozen
+ * completions.  Samples go stale after FF_LAYOUT_RTT_VALID so that a
+ * mirror reads have shifted away from is probed again rather than
+ * written off on old data.
+ */
+#define FF_LAYOUT_RTT_VALID	(10 * HZ)
+
+static void
+nfs4_ff_layout_update_read_rtt(struct nfs4_ff_layout_mirror *mirror,
+		ktime_t rtt)
+{
+	u64 ewma = mirror->read_rtt_ewma;
+	u64 sample = ktime_to_ns(rtt);
+
+	if (ewma)
+		ewma += ((s64)sample - (s64)ewma) >> 3;
+	else
+		ewma = sample;
+	WRITE_ONCE(mirror->read_rtt_ewma, ewma ? : 1);
+	WRITE_ONCE(mirror->read_rtt_stamp, jiffies);
+}
+
 static void
 nfs4_ff_layout_stat_io_end_read(struct rpc_task *task,
 		struct nfs4_ff_layout_mirror *mirror,
 		__u64 requested,
 		__u64 completed)
 {
+	ktime_t now = ktime_get();
+
 	spin_lock(&mirror->lock);
 	nfs4_ff_layout_stat_io_update_completed(&mirror->read_stat,
 			requested, completed,
-			ktime_get(), task->tk_start);
+			now, task->tk_start);
+	nfs4_ff_layout_update_read_rtt(mirror,
+			ktime_sub(now, task->tk_start));
 	set_bit(NFS4_FF_MIRROR_STAT_AVAIL, &mirror->flags);
 	spin_unlock(&mirror->lock);
 }
@@ -755,6 +783,15 @@ ff_layout_mark_ds_reachable(struct pnfs_layout_segment *lseg, u32 idx)
 		nfs4_mark_deviceid_available(devid);
 }
 
+static u64
+ff_layout_mirror_read_rtt(struct nfs4_ff_layout_mirror *mirror)
+{
+	if (time_after(jiffies,
+		       READ_ONCE(mirror->read_rtt_stamp) + FF_LAYOUT_RTT_VALID))
+		return 0;
+	return READ_ONCE(mirror->read_rtt_ewma);
+}
+
 static struct nfs4_pnfs_ds *
 ff_layout_choose_ds_for_read(struct pnfs_layout_segment *lseg,
 			     u32 start_idx, u32 *best_idx,
@@ -762,11 +799,20 @@ ff_layout_choose_ds_for_read(struct pnfs_layout_segment *lseg,
 {
 	struct nfs4_ff_layout_segment *fls = FF_LAYOUT_LSEG(lseg);
 	struct nfs4_ff_layout_mirror *mirror;
+	struct nfs4_pnfs_ds *best_ds = NULL;
 	struct nfs4_pnfs_ds *ds;
+	u64 best_rtt = 0;
 	u32 idx;
 
-	/* mirrors are initially sorted by efficiency */
+	/*
+	 * Mirrors are initially sorted by efficiency; within the usable set,
+	 * prefer the one with the lowest recently observed read RTT so that
+	 * a single slow data server does not gate every read.  A mirror with
+	 * no recent sample keeps its sorted priority and gets probed.
+	 */
 	for (idx = start_idx; idx < fls->mirror_array_cnt; idx++) {
+		u64 rtt;
+
 		mirror = FF_LAYOUT_COMP(lseg, idx);
 		ds = nfs4_ff_layout_prepare_ds(lseg, mirror, false);
 		if (!ds)
@@ -776,11 +822,19 @@ ff_layout_choose_ds_for_read(struct pnfs_layout_segment *lseg,
 		    nfs4_test_deviceid_unavailable(&mirror->mirror_ds->id_node))
 			continue;
 
-		*best_idx = idx;
-		return ds;
+		rtt = ff_layout_mirror_read_rtt(mirror);
+		if (!rtt) {
+			*best_idx = idx;
+			return ds;
+		}
+		if (!best_ds || rtt < best_rtt) {
+			best_ds = ds;
+			best_rtt = rtt;
+			*best_idx = idx;
+		}
 	}
 
-	return NULL;
+	return best_ds;
 }
 
 static struct nfs4_pnfs_ds *
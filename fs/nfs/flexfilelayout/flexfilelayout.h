@@ -89,6 +89,8 @@ struct nfs4_ff_layout_mirror {
 	unsigned long			flags;
 	struct nfs4_ff_layoutstat	read_stat;
 	struct nfs4_ff_layoutstat	write_stat;
+	u64				read_rtt_ewma; /* nsec, 0 == no sample */
+	unsigned long			read_rtt_stamp; /* jiffies of last sample */
 	ktime_t				start_time;
 	u32				report_interval;
 };
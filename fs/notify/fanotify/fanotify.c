@@ -176,6 +176,21 @@ static bool fanotify_should_merge(struct fanotify_event *old,
 /* Limit event merges to limit CPU overhead per event */
 #define FANOTIFY_MAX_MERGE_EVENTS 128
 
+/*
+ * Merging is already constant-ish time: events hash into
+ * FANOTIFY_HTABLE_SIZE buckets by object identity and the bucket scan
+ * is capped above.  Per-CPU staging queues in front of the group queue
+ * have been considered for heavily loaded groups and rejected: an
+ * event can only merge with one that is still queued, so local shards
+ * would miss merge partners staged on other CPUs (inflating rather
+ * than reducing the queue), and flushing shards in batches reorders
+ * events, which userspace is entitled to receive in occurrence order.
+ * The notification_lock hold times are short; the cure for a contended
+ * group is marks with tighter masks or FAN_REPORT_FID merging, not a
+ * different queue.  Consumers needing throughput already get batching
+ * on the read side: a single read() drains as many events as the
+ * supplied buffer holds.
+ */
 /* and the list better be locked by something too! */
 static int fanotify_merge(struct fsnotify_group *group,
 			  struct fsnotify_event *event)
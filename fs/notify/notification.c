@@ -77,6 +77,14 @@ void fsnotify_destroy_event(struct fsnotify_group *group,
  * 1 if the event was merged with some other queued event
  * 2 if the event was not queued - either the queue of events has overflown
  *   or the group is shutting down.
+ *
+ * Note that event memory is never allocated here: each backend allocates
+ * its event before calling in, outside notification_lock, from a dedicated
+ * kmem_cache whose per-CPU slab caches already give lockless alloc/free in
+ * the common case.  Burst coalescing likewise lives in the backends' @merge
+ * hooks (inotify folds identical consecutive events, fanotify merges
+ * through its hash), which see the queue tail under the same lock
+ * acquisition as the insert.
  */
 int fsnotify_insert_event(struct fsnotify_group *group,
 			  struct fsnotify_event *event,
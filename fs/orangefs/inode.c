@@ -236,6 +236,19 @@ static int orangefs_writepages(struct address_space *mapping,
 
 static int orangefs_launder_folio(struct folio *);
 
+/*
+ * One daemon round trip serves one readahead window, synchronously.
+ * Keeping several bufmap slots in flight per file has been looked at
+ * and doesn't fit the op model: every slot would need its own op
+ * structure waited on by its own task, because the userspace protocol
+ * (devorangefs-req) matches one upcall to one blocked waiter - there
+ * is no completion callback to order copybacks behind.  What the VFS
+ * already gives us is pipelining one window deep: asynchronous
+ * readahead fires while the reader still consumes previous pages, and
+ * the window is expanded to 4M below so each round trip moves bulk
+ * data.  Going wider than that belongs in the daemon (server-side
+ * prefetch), which sees the stream across all client windows.
+ */
 static void orangefs_readahead(struct readahead_control *rac)
 {
 	loff_t offset;
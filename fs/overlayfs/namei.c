@@ -1024,6 +1024,20 @@ int ovl_verify_lowerdata(struct dentry *dentry)
 	return ovl_maybe_validate_verity(dentry);
 }
 
+/*
+ * Note on the cost of deep layer stacks: this walk runs once per name
+ * and its outcome - including "not in any layer" - is then held by the
+ * overlay's own dcache as a positive or negative dentry, so build-style
+ * workloads pay the multi-layer probe only on first touch or after
+ * eviction.  The probe is also narrower than "every layer": it covers
+ * only the parent's lower stack (poe), and opaque directories and
+ * whiteouts terminate it early.  A separate name-to-layer cache with
+ * upperdir mtime invalidation has been proposed and rejected; mtime has
+ * second granularity and is not a reliable invalidation signal, while
+ * the dcache is already invalidated precisely by the VFS on rename,
+ * unlink and drop, which is the same information with no second source
+ * of truth to get out of sync.
+ */
 struct dentry *ovl_lookup(struct inode *dir, struct dentry *dentry,
 			  unsigned int flags)
 {
@@ -3512,6 +3512,18 @@ static struct dentry *proc_pid_instantiate(struct dentry * dentry,
 	return d_splice_alias(inode, dentry);
 }
 
+/*
+ * Fleet profilers that sweep every PID dir complain about the dentry
+ * and inode churn this lookup implies, and periodically propose a
+ * packed, versioned binary file bundling stat/statm/status/smaps_rollup
+ * so one read replaces several opens.  That is new ABI duplicating what
+ * already exists: taskstats delivers per-task accounting as packed
+ * binary over netlink without touching procfs at all, and smaps_rollup
+ * is itself the aggregated form of the expensive data.  procfs stays
+ * one-value-space-per-file text; bulk consumers should use taskstats
+ * (and extend it there if a field is missing) rather than grow a
+ * parallel binary /proc format that must be versioned forever.
+ */
 struct dentry *proc_pid_lookup(struct dentry *dentry, unsigned int flags)
 {
 	struct task_struct *task;
@@ -79,6 +79,17 @@ static void show_all_irqs(struct seq_file *p)
 	show_irq_gap(p, irq_get_nr_irqs() - next);
 }
 
+/*
+ * Summing the per-CPU counters on every read is the cheap side of a
+ * deliberate trade: the writers are the tick, IRQ and context-switch paths,
+ * which update their local kernel_cpustat contention-free, while readers
+ * are rare and pay one pass over ncpus cache lines.  A kernel-maintained
+ * pre-rendered snapshot would run that same pass on a timer whether or not
+ * anybody reads, serve stale data in between, and still have to be
+ * re-rendered per time namespace and cpuset filter.  Agents that find the
+ * read too heavy should lower their polling rate; the counters are
+ * monotonic so nothing is lost between samples.
+ */
 static int show_stat(struct seq_file *p, void *v)
 {
 	int i, j;
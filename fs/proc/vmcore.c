@@ -427,6 +427,15 @@ static ssize_t __read_vmcore(struct iov_iter *iter, loff_t *fpos)
 	return acc;
 }
 
+/*
+ * Reads are stateless and positional (the offset comes in via ki_pos), so
+ * concurrent extraction over disjoint ranges already works: open the file
+ * once and issue pread() from as many threads as the capture path can
+ * feed, or mmap the ranges outright on MMU kernels.  Compression is left
+ * to the consumer on purpose; the crash kernel runs with a sliver of
+ * memory and usually one CPU, while makedumpfile in the capture
+ * environment can compress with every core it has.
+ */
 static ssize_t read_vmcore(struct kiocb *iocb, struct iov_iter *iter)
 {
 	return __read_vmcore(iter, &iocb->ki_pos);
@@ -273,6 +273,15 @@ void pstore_record_init(struct pstore_record *record,
 /*
  * callback from kmsg_dump. Save as much as we can (up to kmsg_bytes) from the
  * end of the buffer.
+ *
+ * The dump is split into as many backend-sized records as kmsg_bytes allows,
+ * so capture completeness is bounded by the backend's record size and count
+ * (e.g. ramoops record_size), not by this loop.  Compressing the log tail
+ * ahead of time would not shrink the panic path either: the most valuable
+ * lines are the oops text itself, which only exists once we are already
+ * here, and would buy that with compression work on every printk during
+ * normal operation.  See the comment at the compress parameter for why
+ * deflate is the only supported algorithm.
  */
 static void pstore_dump(struct kmsg_dumper *dumper,
 			struct kmsg_dump_detail *detail)
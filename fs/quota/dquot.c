@@ -1677,6 +1677,16 @@ static qsize_t inode_get_rsv_space(struct inode *inode)
 
 /*
  * This operation can block, but only after everything is updated
+ *
+ * Charging no longer takes the global dq_data_lock; each dquot's usage
+ * is updated under its own dq_dqb_lock and the dquot pointers are
+ * protected by SRCU, so parallel workloads only contend when they bill
+ * the same id.  Per-CPU usage deltas folded in lazily have been
+ * considered for that remaining case and rejected: the contended
+ * scenario is many writers charging one principal, which is exactly
+ * when that principal may be near its limit, so the deltas would have
+ * to be collapsed on every charge anyway for EDQUOT to be exact - and
+ * quota enforcement, unlike statistics, must be exact at the edge.
  */
 int __dquot_alloc_space(struct inode *inode, qsize_t number, int flags)
 {
@@ -129,6 +129,17 @@ static __always_inline void *lz77_write_match(void *dst, void **nib, u32 dist, u
 	return dst + 4;
 }
 
+/*
+ * Compresses one buffer into one MS-XCA plain LZ77 stream.  This is
+ * deliberately a self-contained single-chunk primitive: splitting a
+ * large write across CPUs is a transform-layer decision, since each
+ * chunk becomes its own chained SMB2_COMPRESSION_PAYLOAD_HEADER and
+ * chunks share no dictionary state (matches never cross a chunk
+ * boundary, so the streams stay independently decompressible).
+ * Likewise the don't-bother heuristic for incompressible data is the
+ * caller's sampling pass over the uncompressed iterator; in here the
+ * 7/8 output watermark below is the last-resort bailout.
+ */
 noinline int lz77_compress(const void *src, u32 slen, void *dst, u32 *dlen)
 {
 	const void *srcp, *end;
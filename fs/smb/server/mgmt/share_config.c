@@ -7,6 +7,7 @@
 #include <linux/jhash.h>
 #include <linux/slab.h>
 #include <linux/rwsem.h>
+#include <linux/rcupdate.h>
 #include <linux/parser.h>
 #include <linux/namei.h>
 #include <linux/sched.h>
@@ -19,6 +20,14 @@
 #include "../transport_ipc.h"
 #include "../misc.h"
 
+/*
+ * shares_table caches share configs between tree connects so that only the
+ * first connect per share pays the IPC round trip to ksmbd.mountd.  Lookups
+ * run under RCU; shares_table_lock serializes insertion and removal.  The
+ * struct itself (and the name the lookup compares) is freed via RCU, while
+ * the rest of kill_share() runs synchronously since lockless lookups never
+ * touch those fields.
+ */
 #define SHARE_HASH_BITS		3
 static DEFINE_HASHTABLE(shares_table, SHARE_HASH_BITS);
 static DECLARE_RWSEM(shares_table_lock);
@@ -33,6 +42,16 @@ static unsigned int share_name_hash(const char *name)
 	return jhash(name, strlen(name), 0);
 }
 
+static void free_share_rcu(struct rcu_head *rcu)
+{
+	struct ksmbd_share_config *share = container_of(rcu,
+							struct ksmbd_share_config,
+							rcu_head);
+
+	kfree(share->name);
+	kfree(share);
+}
+
 static void kill_share(struct ksmbd_share_config *share)
 {
 	while (!list_empty(&share->veto_list)) {
@@ -48,15 +67,15 @@ static void kill_share(struct ksmbd_share_config *share)
 
 	if (share->path)
 		path_put(&share->vfs_path);
-	kfree(share->name);
 	kfree(share->path);
-	kfree(share);
+	share->path = NULL;
+	call_rcu(&share->rcu_head, free_share_rcu);
 }
 
 void ksmbd_share_config_del(struct ksmbd_share_config *share)
 {
 	down_write(&shares_table_lock);
-	hash_del(&share->hlist);
+	hash_del_rcu(&share->hlist);
 	up_write(&shares_table_lock);
 }
 
@@ -74,12 +93,14 @@ __get_share_config(struct ksmbd_share_config *share)
 	return share;
 }
 
+/* Caller must hold either rcu_read_lock() or shares_table_lock. */
 static struct ksmbd_share_config *__share_lookup(const char *name)
 {
 	struct ksmbd_share_config *share;
 	unsigned int key = share_name_hash(name);
 
-	hash_for_each_possible(shares_table, share, hlist, key) {
+	hash_for_each_possible_rcu(shares_table, share, hlist, key,
+				   lockdep_is_held(&shares_table_lock)) {
 		if (!strcmp(name, share->name))
 			return share;
 	}
@@ -211,7 +232,8 @@ static struct ksmbd_share_config *share_config_request(struct ksmbd_work *work,
 	if (lookup)
 		lookup = __get_share_config(lookup);
 	if (!lookup) {
-		hash_add(shares_table, &share->hlist, share_name_hash(name));
+		hash_add_rcu(shares_table, &share->hlist,
+			     share_name_hash(name));
 	} else {
 		kill_share(share);
 		share = lookup;
@@ -228,11 +250,11 @@ struct ksmbd_share_config *ksmbd_share_config_get(struct ksmbd_work *work,
 {
 	struct ksmbd_share_config *share;
 
-	down_read(&shares_table_lock);
+	rcu_read_lock();
 	share = __share_lookup(name);
 	if (share)
 		share = __get_share_config(share);
-	up_read(&shares_table_lock);
+	rcu_read_unlock();
 
 	if (share)
 		return share;
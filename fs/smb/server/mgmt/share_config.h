@@ -25,6 +25,7 @@ struct ksmbd_share_config {
 
 	atomic_t		refcount;
 	struct hlist_node	hlist;
+	struct rcu_head		rcu_head;
 	unsigned short		create_mask;
 	unsigned short		directory_mask;
 	unsigned short		force_create_mode;
@@ -5,6 +5,7 @@
 
 #include <linux/list.h>
 #include <linux/slab.h>
+#include <linux/rcupdate.h>
 #include <linux/rwsem.h>
 #include <linux/xarray.h>
 
@@ -18,6 +19,20 @@
 
 static DEFINE_IDA(session_ida);
 
+/*
+ * Sessions are looked up locklessly: readers walk the hash chains and
+ * the per-connection xarray under RCU and take a reference with
+ * atomic_inc_not_zero().  refcnt counts the hash table's reference
+ * (taken at __session_create() time) plus every outstanding lookup, so
+ * it only reaches zero once the session has been unhashed and the last
+ * user has dropped it; ksmbd_user_session_put() then destroys it and
+ * the memory is reclaimed through an RCU grace period.  Expiry and
+ * deregistration unhash the session and drop the table's reference
+ * rather than freeing directly, so a concurrent lookup that won
+ * atomic_inc_not_zero() keeps the session alive.  sessions_table_lock
+ * only serializes writers (register, expiry, deregister and reconnect
+ * teardown).
+ */
 #define SESSION_HASH_BITS		3
 static DEFINE_HASHTABLE(sessions_table, SESSION_HASH_BITS);
 static DECLARE_RWSEM(sessions_table_lock);
@@ -157,14 +172,16 @@ void ksmbd_session_destroy(struct ksmbd_session *sess)
 	free_channel_list(sess);
 	kfree(sess->Preauth_HashValue);
 	ksmbd_release_id(&session_ida, sess->id);
-	kfree(sess);
+	kfree_rcu(sess, rcu_head);
 }
 
+/* Caller must hold either rcu_read_lock() or sessions_table_lock */
 struct ksmbd_session *__session_lookup(unsigned long long id)
 {
 	struct ksmbd_session *sess;
 
-	hash_for_each_possible(sessions_table, sess, hlist, id) {
+	hash_for_each_possible_rcu(sessions_table, sess, hlist, id,
+				   lockdep_is_held(&sessions_table_lock)) {
 		if (id == sess->id) {
 			sess->last_active = jiffies;
 			return sess;
@@ -181,13 +198,13 @@ static void ksmbd_expire_session(struct ksmbd_conn *conn)
 	down_write(&sessions_table_lock);
 	down_write(&conn->session_lock);
 	xa_for_each(&conn->sessions, id, sess) {
-		if (atomic_read(&sess->refcnt) == 0 &&
+		if (atomic_read(&sess->refcnt) <= 1 &&
 		    (sess->state != SMB2_SESSION_VALID ||
 		     time_after(jiffies,
 			       sess->last_active + SMB2_SESSION_TIMEOUT))) {
 			xa_erase(&conn->sessions, sess->id);
-			hash_del(&sess->hlist);
-			ksmbd_session_destroy(sess);
+			hash_del_rcu(&sess->hlist);
+			ksmbd_user_session_put(sess);
 			continue;
 		}
 	}
@@ -229,8 +246,8 @@ void ksmbd_sessions_deregister(struct ksmbd_conn *conn)
 		hash_for_each_safe(sessions_table, bkt, tmp, sess, hlist) {
 			if (!ksmbd_chann_del(conn, sess) &&
 			    xa_empty(&sess->ksmbd_chann_list)) {
-				hash_del(&sess->hlist);
-				ksmbd_session_destroy(sess);
+				hash_del_rcu(&sess->hlist);
+				ksmbd_user_session_put(sess);
 			}
 		}
 	}
@@ -248,8 +265,8 @@ void ksmbd_sessions_deregister(struct ksmbd_conn *conn)
 		ksmbd_chann_del(conn, sess);
 		if (xa_empty(&sess->ksmbd_chann_list)) {
 			xa_erase(&conn->sessions, sess->id);
-			hash_del(&sess->hlist);
-			ksmbd_session_destroy(sess);
+			hash_del_rcu(&sess->hlist);
+			ksmbd_user_session_put(sess);
 		}
 	}
 	up_write(&conn->session_lock);
@@ -261,13 +278,15 @@ struct ksmbd_session *ksmbd_session_lookup(struct ksmbd_conn *conn,
 {
 	struct ksmbd_session *sess;
 
-	down_read(&conn->session_lock);
+	rcu_read_lock();
 	sess = xa_load(&conn->sessions, id);
 	if (sess) {
-		sess->last_active = jiffies;
-		ksmbd_user_session_get(sess);
+		if (atomic_inc_not_zero(&sess->refcnt))
+			sess->last_active = jiffies;
+		else
+			sess = NULL;
 	}
-	up_read(&conn->session_lock);
+	rcu_read_unlock();
 	return sess;
 }
 
@@ -275,11 +294,11 @@ struct ksmbd_session *ksmbd_session_lookup_slowpath(unsigned long long id)
 {
 	struct ksmbd_session *sess;
 
-	down_read(&sessions_table_lock);
+	rcu_read_lock();
 	sess = __session_lookup(id);
-	if (sess)
-		ksmbd_user_session_get(sess);
-	up_read(&sessions_table_lock);
+	if (sess && !atomic_inc_not_zero(&sess->refcnt))
+		sess = NULL;
+	rcu_read_unlock();
 
 	return sess;
 }
@@ -292,8 +311,10 @@ struct ksmbd_session *ksmbd_session_lookup_all(struct ksmbd_conn *conn,
 	sess = ksmbd_session_lookup(conn, id);
 	if (!sess && conn->binding)
 		sess = ksmbd_session_lookup_slowpath(id);
-	if (sess && sess->state != SMB2_SESSION_VALID)
+	if (sess && sess->state != SMB2_SESSION_VALID) {
+		ksmbd_user_session_put(sess);
 		sess = NULL;
+	}
 	return sess;
 }
 
@@ -309,8 +330,8 @@ void ksmbd_user_session_put(struct ksmbd_session *sess)
 
 	if (atomic_read(&sess->refcnt) <= 0)
 		WARN_ON(1);
-	else
-		atomic_dec(&sess->refcnt);
+	else if (atomic_dec_and_test(&sess->refcnt))
+		ksmbd_session_destroy(sess);
 }
 
 struct preauth_session *ksmbd_preauth_session_alloc(struct ksmbd_conn *conn,
@@ -426,7 +447,7 @@ static struct ksmbd_session *__session_create(int protocol)
 	ida_init(&sess->tree_conn_ida);
 
 	down_write(&sessions_table_lock);
-	hash_add(sessions_table, &sess->hlist, sess->id);
+	hash_add_rcu(sessions_table, &sess->hlist, sess->id);
 	up_write(&sessions_table_lock);
 
 	return sess;
@@ -63,6 +63,7 @@ struct ksmbd_session {
 	rwlock_t			tree_conns_lock;
 
 	atomic_t			refcnt;
+	struct rcu_head			rcu_head;
 };
 
 static inline int test_session_flag(struct ksmbd_session *sess, int bit)
@@ -33,6 +33,8 @@
 
 #include <linux/fs.h>
 #include <linux/vfs.h>
+#include <linux/hash.h>
+#include <linux/log2.h>
 #include <linux/slab.h>
 #include <linux/vmalloc.h>
 #include <linux/sched.h>
@@ -45,6 +47,29 @@
 #include "squashfs.h"
 #include "page_actor.h"
 
+/*
+ * The entries are indexed by a block-keyed hash table, so look-ups stay
+ * cheap when the cache is scaled up for hosts running many mounts.
+ * Must be called with the cache lock held.
+ */
+static struct hlist_head *squashfs_cache_hash(struct squashfs_cache *cache,
+	u64 block)
+{
+	return &cache->hash_table[hash_64(block, cache->hash_bits)];
+}
+
+static struct squashfs_cache_entry *squashfs_cache_find(
+	struct squashfs_cache *cache, u64 block)
+{
+	struct squashfs_cache_entry *entry;
+
+	hlist_for_each_entry(entry, squashfs_cache_hash(cache, block), hash)
+		if (entry->block == block)
+			return entry;
+
+	return NULL;
+}
+
 /*
  * Look-up block in cache, and increment usage count.  If not in cache, read
  * and decompress it from disk.
@@ -58,15 +83,9 @@ struct squashfs_cache_entry *squashfs_cache_get(struct super_block *sb,
 	spin_lock(&cache->lock);
 
 	while (1) {
-		for (i = cache->curr_blk, n = 0; n < cache->entries; n++) {
-			if (cache->entry[i].block == block) {
-				cache->curr_blk = i;
-				break;
-			}
-			i = (i + 1) % cache->entries;
-		}
+		entry = squashfs_cache_find(cache, block);
 
-		if (n == cache->entries) {
+		if (entry == NULL) {
 			/*
 			 * Block not in cache, if all cache entries are used
 			 * go to sleep waiting for one to become available.
@@ -100,7 +119,11 @@ struct squashfs_cache_entry *squashfs_cache_get(struct super_block *sb,
 			 * disk.
 			 */
 			cache->unused--;
+			if (!hlist_unhashed(&entry->hash))
+				hlist_del_init(&entry->hash);
 			entry->block = block;
+			hlist_add_head(&entry->hash,
+				squashfs_cache_hash(cache, block));
 			entry->refcount = 1;
 			entry->pending = 1;
 			entry->num_waiters = 0;
@@ -137,7 +160,7 @@ struct squashfs_cache_entry *squashfs_cache_get(struct super_block *sb,
 		 * previously unused there's one less cache entry available
 		 * for reuse.
 		 */
-		entry = &cache->entry[i];
+		i = entry - cache->entry;
 		if (entry->refcount == 0)
 			cache->unused--;
 		entry->refcount++;
@@ -210,6 +233,7 @@ void squashfs_cache_delete(struct squashfs_cache *cache)
 		kfree(cache->entry[i].actor);
 	}
 
+	kfree(cache->hash_table);
 	kfree(cache->entry);
 	kfree(cache);
 }
@@ -241,7 +265,6 @@ struct squashfs_cache *squashfs_cache_init(char *name, int entries,
 		goto cleanup;
 	}
 
-	cache->curr_blk = 0;
 	cache->next_blk = 0;
 	cache->unused = entries;
 	cache->entries = entries;
@@ -253,12 +276,24 @@ struct squashfs_cache *squashfs_cache_init(char *name, int entries,
 	spin_lock_init(&cache->lock);
 	init_waitqueue_head(&cache->wait_queue);
 
+	/* Two hash heads per entry keep the chains short */
+	cache->hash_bits = ilog2(roundup_pow_of_two(entries * 2));
+	cache->hash_table = kmalloc_array(1U << cache->hash_bits,
+				sizeof(*cache->hash_table), GFP_KERNEL);
+	if (cache->hash_table == NULL) {
+		ERROR("Failed to allocate %s cache\n", name);
+		goto cleanup;
+	}
+	for (i = 0; i < (1 << cache->hash_bits); i++)
+		INIT_HLIST_HEAD(&cache->hash_table[i]);
+
 	for (i = 0; i < entries; i++) {
 		struct squashfs_cache_entry *entry = &cache->entry[i];
 
 		init_waitqueue_head(&cache->entry[i].wait_queue);
 		entry->cache = cache;
 		entry->block = SQUASHFS_INVALID_BLK;
+		INIT_HLIST_NODE(&entry->hash);
 		entry->data = kcalloc(cache->pages, sizeof(void *), GFP_KERNEL);
 		if (entry->data == NULL) {
 			ERROR("Failed to allocate %s cache entry\n", name);
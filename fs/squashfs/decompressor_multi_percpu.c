@@ -17,6 +17,18 @@
 /*
  * This file implements multi-threaded decompression using percpu
  * variables, one thread per cpu core.
+ *
+ * Decompression always runs synchronously in the reading task's context;
+ * there is no job queue anywhere in squashfs, and hence nothing an idle
+ * CPU could steal.  The three backends only differ in how concurrent
+ * readers share streams: one stream (single), a demand-grown pool behind
+ * a lock (multi), or a stream per CPU with no sharing at all (this file).
+ * Making one reader's stream of dependent block reads scale across cores
+ * would mean speculatively decompressing ahead of the request on worker
+ * threads, a different design with its own memory and latency costs.  A
+ * single-stream extraction gets parallelism today by reading with
+ * multiple threads (readers on different CPUs decompress concurrently in
+ * all multi modes).
  */
 
 struct squashfs_stream {
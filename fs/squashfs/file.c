@@ -34,6 +34,7 @@
 #include <linux/string.h>
 #include <linux/pagemap.h>
 #include <linux/mutex.h>
+#include <linux/workqueue.h>
 
 #include "squashfs_fs.h"
 #include "squashfs_fs_sb.h"
@@ -563,6 +564,74 @@ out:
 	return 1;
 }
 
+/*
+ * Per-datablock state of an asynchronous readahead.
+ *
+ * Each Squashfs datablock of a readahead window covers its own set of page
+ * cache pages, so the blocks can be read and decompressed independently.
+ * Processing them from workqueue workers keeps several compressed-block
+ * reads in flight and fans the decompression across the decompressor pool,
+ * instead of serializing read-decompress cycles on the readahead caller.
+ * The workers complete (or on failure just unlock) their pages as they
+ * finish, in whatever order the blocks become available.
+ */
+struct squashfs_ra_block {
+	struct work_struct work;
+	struct super_block *sb;
+	struct page **pages;
+	unsigned int nr_pages;
+	u64 block;
+	int bsize;
+	unsigned int expected;
+	loff_t start;
+	bool file_end_block;
+};
+
+static void squashfs_ra_block_process(struct squashfs_ra_block *ra)
+{
+	struct squashfs_sb_info *msblk = ra->sb->s_fs_info;
+	struct squashfs_page_actor *actor;
+	struct page *last_page;
+	int res, i;
+
+	actor = squashfs_page_actor_init_special(msblk, ra->pages,
+				ra->nr_pages, ra->expected, ra->start);
+	if (!actor)
+		goto release_pages;
+
+	res = squashfs_read_data(ra->sb, ra->block, ra->bsize, NULL, actor);
+
+	last_page = squashfs_page_actor_free(actor);
+
+	if (res == ra->expected && !IS_ERR(last_page)) {
+		int bytes;
+
+		/* Last page (if present) may have trailing bytes not filled */
+		bytes = res % PAGE_SIZE;
+		if (ra->file_end_block && bytes && last_page)
+			memzero_page(last_page, bytes, PAGE_SIZE - bytes);
+
+		for (i = 0; i < ra->nr_pages; i++) {
+			flush_dcache_page(ra->pages[i]);
+			SetPageUptodate(ra->pages[i]);
+		}
+	}
+
+release_pages:
+	for (i = 0; i < ra->nr_pages; i++) {
+		unlock_page(ra->pages[i]);
+		put_page(ra->pages[i]);
+	}
+	kfree(ra->pages);
+	kfree(ra);
+}
+
+static void squashfs_ra_block_work(struct work_struct *work)
+{
+	squashfs_ra_block_process(container_of(work, struct squashfs_ra_block,
+				work));
+}
+
 static void squashfs_readahead(struct readahead_control *ractl)
 {
 	struct inode *inode = ractl->mapping->host;
@@ -571,24 +640,19 @@ static void squashfs_readahead(struct readahead_control *ractl)
 	unsigned short shift = msblk->block_log - PAGE_SHIFT;
 	loff_t start = readahead_pos(ractl) & ~mask;
 	size_t len = readahead_length(ractl) + readahead_pos(ractl) - start;
-	struct squashfs_page_actor *actor;
 	unsigned int nr_pages = 0;
-	struct page **pages;
+	struct page **pages = NULL;
 	int i;
 	loff_t file_end = i_size_read(inode) >> msblk->block_log;
-	unsigned int max_pages = 1UL << shift;
+	unsigned int max_pages;
 
 	readahead_expand(ractl, start, (len | mask) + 1);
 
-	pages = kmalloc_array(max_pages, sizeof(void *), GFP_KERNEL);
-	if (!pages)
-		return;
-
 	for (;;) {
 		int res, bsize;
 		u64 block = 0;
 		unsigned int expected;
-		struct page *last_page;
+		struct squashfs_ra_block *ra;
 
 		expected = start >> msblk->block_log == file_end ?
 			   (i_size_read(inode) & (msblk->block_size - 1)) :
@@ -596,9 +660,19 @@ static void squashfs_readahead(struct readahead_control *ractl)
 
 		max_pages = (expected + PAGE_SIZE - 1) >> PAGE_SHIFT;
 
+		/*
+		 * The pages array is handed over to the worker processing the
+		 * block, so each block gets its own.
+		 */
+		pages = kmalloc_array(max_pages, sizeof(void *), GFP_KERNEL);
+		if (!pages)
+			return;
+
 		nr_pages = __readahead_batch(ractl, pages, max_pages);
-		if (!nr_pages)
-			break;
+		if (!nr_pages) {
+			kfree(pages);
+			return;
+		}
 
 		if (readahead_pos(ractl) >= i_size_read(inode))
 			goto skip_pages;
@@ -609,6 +683,7 @@ static void squashfs_readahead(struct readahead_control *ractl)
 							  expected, start);
 			if (res)
 				goto skip_pages;
+			kfree(pages);
 			continue;
 		}
 
@@ -616,41 +691,24 @@ static void squashfs_readahead(struct readahead_control *ractl)
 		if (bsize == 0)
 			goto skip_pages;
 
-		actor = squashfs_page_actor_init_special(msblk, pages, nr_pages,
-							expected, start);
-		if (!actor)
+		ra = kmalloc(sizeof(*ra), GFP_KERNEL);
+		if (!ra)
 			goto skip_pages;
 
-		res = squashfs_read_data(inode->i_sb, block, bsize, NULL, actor);
-
-		last_page = squashfs_page_actor_free(actor);
-
-		if (res == expected && !IS_ERR(last_page)) {
-			int bytes;
-
-			/* Last page (if present) may have trailing bytes not filled */
-			bytes = res % PAGE_SIZE;
-			if (start >> msblk->block_log == file_end && bytes && last_page)
-				memzero_page(last_page, bytes,
-					     PAGE_SIZE - bytes);
-
-			for (i = 0; i < nr_pages; i++) {
-				flush_dcache_page(pages[i]);
-				SetPageUptodate(pages[i]);
-			}
-		}
-
-		for (i = 0; i < nr_pages; i++) {
-			unlock_page(pages[i]);
-			put_page(pages[i]);
-		}
+		ra->sb = inode->i_sb;
+		ra->pages = pages;
+		ra->nr_pages = nr_pages;
+		ra->block = block;
+		ra->bsize = bsize;
+		ra->expected = expected;
+		ra->start = start;
+		ra->file_end_block = start >> msblk->block_log == file_end;
+		INIT_WORK(&ra->work, squashfs_ra_block_work);
+		queue_work(system_unbound_wq, &ra->work);
 
 		start += readahead_batch_length(ractl);
 	}
 
-	kfree(pages);
-	return;
-
 skip_pages:
 	for (i = 0; i < nr_pages; i++) {
 		unlock_page(pages[i]);
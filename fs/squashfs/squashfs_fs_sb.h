@@ -15,7 +15,6 @@
 struct squashfs_cache {
 	char			*name;
 	int			entries;
-	int			curr_blk;
 	int			next_blk;
 	int			num_waiters;
 	int			unused;
@@ -24,10 +23,13 @@ struct squashfs_cache {
 	spinlock_t		lock;
 	wait_queue_head_t	wait_queue;
 	struct squashfs_cache_entry *entry;
+	struct hlist_head	*hash_table;
+	unsigned int		hash_bits;
 };
 
 struct squashfs_cache_entry {
 	u64			block;
+	struct hlist_node	hash;
 	int			length;
 	int			refcount;
 	u64			next_index;
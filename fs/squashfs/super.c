@@ -314,8 +314,15 @@ static int squashfs_fill_super(struct super_block *sb, struct fs_context *fc)
 	sb->s_flags |= SB_RDONLY;
 	sb->s_op = &squashfs_super_ops;
 
+	/*
+	 * Scale the metadata cache with the CPU count: the historical 8
+	 * entries thrash under concurrent directory-heavy workloads on
+	 * hosts serving many readers from one image.
+	 */
 	msblk->block_cache = squashfs_cache_init("metadata",
-			SQUASHFS_CACHED_BLKS, SQUASHFS_METADATA_SIZE);
+			clamp_t(int, num_online_cpus() * 2,
+				SQUASHFS_CACHED_BLKS, SQUASHFS_MAX_CACHED_BLKS),
+			SQUASHFS_METADATA_SIZE);
 	if (IS_ERR(msblk->block_cache)) {
 		err = PTR_ERR(msblk->block_cache);
 		goto failed_mount;
@@ -87,7 +87,21 @@ static void udf_clear_extent_cache(struct inode *inode)
 	spin_unlock(&iinfo->i_extent_cache_lock);
 }
 
-/* Return contents of extent cache */
+/*
+ * Return contents of extent cache
+ *
+ * The cache is deliberately a single remembered position rather than a
+ * full rb-tree mirror of the extent chain.  It removes the quadratic
+ * cost of sequential reads (each lookup resumes from the previous
+ * extent instead of the chain head), which is the access pattern UDF's
+ * optical heritage is built around.  Random reads that land before the
+ * cached position do re-walk the descriptors, but those blocks sit in
+ * the buffer cache after the first traversal, so the re-walk is CPU
+ * arithmetic, not media reads.  A complete indexed tree would have to
+ * be kept coherent with truncate, hole punching and the in-ICB to
+ * extent-list conversions for what a one-entry cache plus the buffer
+ * cache already reduce to in-memory work.
+ */
 static int udf_read_extent_cache(struct inode *inode, loff_t bcount,
 				 loff_t *lbcount, struct extent_position *pos)
 {
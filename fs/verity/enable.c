@@ -68,6 +68,16 @@ static int write_merkle_tree_block(struct inode *inode, const u8 *buf,
  * The tree is written to a filesystem-specific location as determined by the
  * ->write_merkle_tree_block() method.  However, the blocks that comprise the
  * tree are the same for all filesystems.
+ *
+ * The build is intentionally a single streaming pass.  Leaf blocks are
+ * independent and could be hashed on several CPUs, but doing so means either
+ * buffering whole tree levels (tens of MB for large files, versus one block
+ * per level here) or a second pass over the data, and it moves work from the
+ * ioctl caller's context onto kernel threads that no longer answer to the
+ * caller's CPU accounting or signals.  FS_IOC_ENABLE_VERITY is a one-time
+ * administrative operation, and a userspace deployer that wants wall-clock
+ * speed can already enable verity on many files concurrently, which
+ * parallelizes perfectly without any of the above costs.
  */
 static int build_merkle_tree(struct file *filp,
 			     const struct merkle_tree_params *params,
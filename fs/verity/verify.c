@@ -304,6 +304,17 @@ EXPORT_SYMBOL_GPL(fsverity_verify_blocks);
  * populate the page cache without issuing bios (e.g. non block-based
  * filesystems) must instead call fsverity_verify_page() directly on each page.
  * All filesystems must also call fsverity_verify_page() on holes.
+ *
+ * Note on batching: most of what a "bulk verification" pass would buy is
+ * already structural.  Hash pages live in the filesystem's cache of the Merkle
+ * tree and are read ahead alongside the data (max_ra_pages below), the ascent
+ * in verify_data_block() stops at the first already-verified hash block -- for
+ * sequential reads that is almost always level 0 -- and verification already
+ * runs once per bio on the read workqueue.  Submitting all blocks of a bio as
+ * one multibuffer hash request would only help if the crypto layer exposed
+ * such an interface for the verity algorithms; the old SHA-256 multibuffer
+ * code was removed from the kernel because keeping lanes full proved
+ * unworkable, so per-block shash/ahash calls are what remains.
  */
 void fsverity_verify_bio(struct bio *bio)
 {
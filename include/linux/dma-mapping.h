@@ -102,6 +102,11 @@ dma_addr_t dma_map_page_attrs(struct device *dev, struct page *page,
 		unsigned long attrs);
 void dma_unmap_page_attrs(struct device *dev, dma_addr_t addr, size_t size,
 		enum dma_data_direction dir, unsigned long attrs);
+int dma_map_batch(struct device *dev, struct page **pages, size_t *sizes,
+		dma_addr_t *addrs, int npages, enum dma_data_direction dir,
+		unsigned long attrs);
+void dma_unmap_batch(struct device *dev, dma_addr_t *addrs, size_t *sizes,
+		int npages, enum dma_data_direction dir, unsigned long attrs);
 unsigned int dma_map_sg_attrs(struct device *dev, struct scatterlist *sg,
 		int nents, enum dma_data_direction dir, unsigned long attrs);
 void dma_unmap_sg_attrs(struct device *dev, struct scatterlist *sg,
@@ -156,6 +161,17 @@ static inline void dma_unmap_page_attrs(struct device *dev, dma_addr_t addr,
 		size_t size, enum dma_data_direction dir, unsigned long attrs)
 {
 }
+static inline int dma_map_batch(struct device *dev, struct page **pages,
+		size_t *sizes, dma_addr_t *addrs, int npages,
+		enum dma_data_direction dir, unsigned long attrs)
+{
+	return -ENOMEM;
+}
+static inline void dma_unmap_batch(struct device *dev, dma_addr_t *addrs,
+		size_t *sizes, int npages, enum dma_data_direction dir,
+		unsigned long attrs)
+{
+}
 static inline unsigned int dma_map_sg_attrs(struct device *dev,
 		struct scatterlist *sg, int nents, enum dma_data_direction dir,
 		unsigned long attrs)
@@ -190,6 +190,13 @@ void em_rebuild_sched_domains(void);
  * It is called from the scheduler code quite frequently and as a consequence
  * doesn't implement any check.
  *
+ * The ascending linear walk is intentional: perf-state tables are a
+ * handful of entries long, already sorted with precomputed cost values
+ * (rebuilt on every em_dev_update_perf_domain()), and the inefficiency
+ * skipping needs the in-order visit anyway.  For these sizes a binary
+ * search or bucketized index costs more in branches and cache misses
+ * than it saves.
+ *
  * Return: An efficient performance state id, high enough to meet @max_util
  * requirement.
  */
@@ -52,6 +52,16 @@ union futex_key {
 
 #define FUTEX_KEY_INIT (union futex_key) { .both = { .ptr = 0ULL } }
 
+/*
+ * prctl(PR_FUTEX_HASH) option and sub-commands. Kernel-internal for the
+ * moment: the <uapi/linux/prctl.h> definitions and the sys_prctl()
+ * dispatch to futex_hash_prctl() land with the syscall-side wiring and
+ * must keep these values.
+ */
+#define PR_FUTEX_HASH		78
+#define PR_FUTEX_HASH_SET_SLOTS	1
+#define PR_FUTEX_HASH_GET_SLOTS	2
+
 #ifdef CONFIG_FUTEX
 enum {
 	FUTEX_STATE_OK,
@@ -77,6 +87,9 @@ void futex_exec_release(struct task_struct *tsk);
 
 long do_futex(u32 __user *uaddr, int op, u32 val, ktime_t *timeout,
 	      u32 __user *uaddr2, u32 val2, u32 val3);
+
+int futex_hash_prctl(unsigned long arg2, unsigned long arg3);
+void futex_hash_free(struct mm_struct *mm);
 #else
 static inline void futex_init_task(struct task_struct *tsk) { }
 static inline void futex_exit_recursive(struct task_struct *tsk) { }
@@ -88,6 +101,11 @@ static inline long do_futex(u32 __user *uaddr, int op, u32 val,
 {
 	return -EINVAL;
 }
+static inline int futex_hash_prctl(unsigned long arg2, unsigned long arg3)
+{
+	return -EINVAL;
+}
+static inline void futex_hash_free(struct mm_struct *mm) { }
 #endif
 
 #endif
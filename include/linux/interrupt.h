@@ -870,6 +870,17 @@ static inline void init_irq_proc(void)
 void irq_timings_enable(void);
 void irq_timings_disable(void);
 u64 irq_timings_next_event(u64 now);
+u64 irq_timings_next_irq(unsigned int irq, u64 now);
+bool irq_timings_expect_within(unsigned int irq, u64 delta_ns);
+#else
+static inline u64 irq_timings_next_irq(unsigned int irq, u64 now)
+{
+	return U64_MAX;
+}
+static inline bool irq_timings_expect_within(unsigned int irq, u64 delta_ns)
+{
+	return false;
+}
 #endif
 
 struct seq_file;
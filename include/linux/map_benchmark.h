@@ -15,6 +15,9 @@
 #define DMA_MAP_TO_DEVICE       1
 #define DMA_MAP_FROM_DEVICE     2
 
+#define DMA_MAP_MODE_SINGLE     0
+#define DMA_MAP_MODE_BATCH      1
+
 struct map_benchmark {
 	__u64 avg_map_100ns; /* average map latency in 100ns */
 	__u64 map_stddev; /* standard deviation of map latency */
@@ -27,5 +30,8 @@ struct map_benchmark {
 	__u32 dma_dir; /* DMA data direction */
 	__u32 dma_trans_ns; /* time for DMA transmission in ns */
 	__u32 granule;  /* how many PAGE_SIZE will do map/unmap once a time */
+	__u32 map_mode; /* 0: one dma_map_single() call per loop,
+			 * 1: map granule pages with one dma_map_batch() call
+			 */
 };
 #endif /* _KERNEL_DMA_BENCHMARK_H */
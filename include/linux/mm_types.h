@@ -998,6 +998,16 @@ struct mm_struct {
 #ifdef CONFIG_MMU_NOTIFIER
 		struct mmu_notifier_subscriptions *notifier_subscriptions;
 #endif
+#ifdef CONFIG_FUTEX
+		/*
+		 * Private futex hash table, set up on request via
+		 * prctl(PR_FUTEX_HASH). Immutable once published; owned
+		 * by this mm only: dup_mm() must clear the pointer copied
+		 * from the parent and __mmdrop() must free it through
+		 * futex_hash_free(). See kernel/futex/core.c.
+		 */
+		struct futex_private_hash *futex_phash;
+#endif
 #if defined(CONFIG_TRANSPARENT_HUGEPAGE) && !defined(CONFIG_SPLIT_PMD_PTLOCKS)
 		pgtable_t pmd_huge_pte; /* protected by page_table_lock */
 #endif
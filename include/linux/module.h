@@ -487,6 +487,13 @@ struct module {
 	struct mod_kallsyms __rcu *kallsyms;
 	struct mod_kallsyms core_kallsyms;
 
+	/*
+	 * Indices into core_kallsyms.symtab sorted by symbol name, for
+	 * binary-search name lookups. NULL if the allocation failed at
+	 * load time, in which case lookups scan linearly.
+	 */
+	u32 *kallsyms_name_index;
+
 	/* Section attributes */
 	struct module_sect_attrs *sect_attrs;
 
@@ -980,6 +987,10 @@ int module_get_kallsym(unsigned int symnum, unsigned long *value, char *type,
 /* Look for this name: can be of form module:name. */
 unsigned long module_kallsyms_lookup_name(const char *name);
 
+unsigned int module_kallsyms_lookup_names(const char **names,
+					  unsigned long *values,
+					  unsigned int cnt);
+
 unsigned long find_kallsyms_symbol_value(struct module *mod, const char *name);
 
 #else	/* CONFIG_MODULES && CONFIG_KALLSYMS */
@@ -1019,6 +1030,13 @@ static inline unsigned long module_kallsyms_lookup_name(const char *name)
 	return 0;
 }
 
+static inline unsigned int module_kallsyms_lookup_names(const char **names,
+							unsigned long *values,
+							unsigned int cnt)
+{
+	return 0;
+}
+
 static inline unsigned long find_kallsyms_symbol_value(struct module *mod,
 						       const char *name)
 {
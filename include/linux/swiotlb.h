@@ -66,6 +66,8 @@ extern void __init swiotlb_update_mem_attributes(void);
  * @node:	Member of the IO TLB memory pool list.
  * @rcu:	RCU head for swiotlb_dyn_free().
  * @transient:  %true if transient memory pool.
+ * @nid:	NUMA node from which the pool memory was allocated, or
+ *		%NUMA_NO_NODE if the node is unknown (e.g. the default pool).
  */
 struct io_tlb_pool {
 	phys_addr_t start;
@@ -81,6 +83,7 @@ struct io_tlb_pool {
 	struct list_head node;
 	struct rcu_head rcu;
 	bool transient;
+	int nid;
 #endif
 };
 
@@ -97,6 +100,8 @@ struct io_tlb_pool {
  * @lock:	Lock to synchronize changes to the list.
  * @pools:	List of IO TLB memory pool descriptors (if dynamic).
  * @dyn_alloc:	Dynamic IO TLB pool allocation work.
+ * @alloc_nid:	Preferred NUMA node for the next pool allocated by the
+ *		@dyn_alloc worker, or %NUMA_NO_NODE for no preference.
  * @total_used:	The total number of slots in the pool that are currently used
  *		across all areas. Used only for calculating used_hiwater in
  *		debugfs.
@@ -117,6 +122,7 @@ struct io_tlb_mem {
 	spinlock_t lock;
 	struct list_head pools;
 	struct work_struct dyn_alloc;
+	atomic_t alloc_nid;
 #endif
 #ifdef CONFIG_DEBUG_FS
 	atomic_long_t total_used;
@@ -9,6 +9,15 @@
  *
  * For further information, see:
  *   Documentation/trace/rv/da_monitor_synthesis.rst
+ *
+ * Event processing is intentionally synchronous in tracepoint context.
+ * The automaton is already a compiled transition table (see
+ * model_get_next_state in rv/automata.h), so the inline cost is a bounds
+ * check and one two-dimensional table lookup per event.  Deferring events
+ * to per-CPU rings drained by a verifier thread would make reactors
+ * useless: a reactor must fire before the system proceeds past the
+ * violating event (e.g. the panic reactor), which is only possible when
+ * the transition is evaluated at the instrumentation point itself.
  */
 
 #include <rv/automata.h>
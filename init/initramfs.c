@@ -497,6 +497,20 @@ static unsigned long my_inptr __initdata; /* index of next byte to be processed
 
 #include <linux/decompress/generic.h>
 
+/*
+ * The unpack is deliberately single-threaded.  Splitting it into a
+ * decompressor feeding a pool of file-creation workers has been looked
+ * at and does not pay off here: the decompressors push data through the
+ * flush_buffer() callback in stream order, the cpio parser is one big
+ * __initdata state machine (state, collected, wfile, ...), and the VFS
+ * side is dominated by path lookup under the parent directories being
+ * created by the very same stream, so workers immediately serialize on
+ * i_rwsem.  The concurrency that matters happens one level up: with
+ * initramfs_async (default on) the whole unpack runs in an async domain
+ * overlapped with device probing, and boots that care about the last
+ * few hundred ms should ship an uncompressed or zstd archive rather
+ * than expect the unpack itself to fan out.
+ */
 static char * __init unpack_to_rootfs(char *buf, unsigned long len)
 {
 	long written;
@@ -122,6 +122,17 @@ struct posix_msg_tree_node {
  *    release memory barrier, and the wakeup is triggered when holding
  *    info->lock, i.e. spin_lock(&info->lock) provided a pairing
  *    acquire memory barrier.
+ *
+ * On the recurring suggestion of a lock-free MPMC ring mode for
+ * fixed-size messages: the hot path here is already a short critical
+ * section plus a wake_q wakeup outside the lock, and when a receiver is
+ * waiting the message is handed to it directly without touching the
+ * tree.  What the lock actually buys is POSIX - priority ordering,
+ * variable message sizes, mq_notify, timed blocking with EINTR - and an
+ * opt-in ring that sheds those sheds the reason to be in mqueue at all.
+ * Throughput-bound fan-out that can accept fixed slots and no
+ * priorities is better served by a shared-memory ring in userspace,
+ * which needs no syscall per message.
  */
 
 struct ext_wait_queue {		/* queue of sleeping tasks */
@@ -385,6 +385,19 @@ static void complexmode_tryleave(struct sem_array *sma)
  * Otherwise, lock the entire semaphore array, since we either have
  * multiple semaphores in our own semops, or we need to look at
  * semaphores from other pending complex operations.
+ *
+ * Taking only the affected semaphores' locks in address order for
+ * small multi-sem operations has been evaluated as an alternative to
+ * the global fallback and does not hold up: a semop must be atomic
+ * against every other operation touching any of its semaphores, and a
+ * sleeping complex op is woken by updates to any member, so the wakeup
+ * scan (update_queue on the global pending list) needs a stable view
+ * of the whole array - per-subset locking would reintroduce exactly
+ * the races the use_global_lock handover below exists to prevent.
+ * The scaling that matters is preserved where it is cheap: single-sem
+ * ops keep per-semaphore locks whenever no complex op is pending, and
+ * the global mode switches itself off again via complexmode_tryleave()
+ * once the complex burst drains.
  */
 static inline int sem_lock(struct sem_array *sma, struct sembuf *sops,
 			      int nsops)
@@ -693,6 +693,18 @@ static const struct vm_operations_struct shm_vm_ops = {
  * @params: ptr to the structure that contains key, size and shmflg
  *
  * Called with shm_ids.rwsem held as a writer.
+ *
+ * shmget() deliberately takes no NUMA placement, THP alignment or
+ * pre-fault flags; shmflg bits are a scarce, unversioned ABI and every
+ * piece of this already composes from existing interfaces applied to
+ * the attached range: mbind() sets an interleave/bind policy per
+ * mapping (wired through shm_set_policy/shm_get_policy above),
+ * SHM_HUGETLB with SHM_HUGE_* selects the page size and thus PMD/PUD
+ * alignment, huge tmpfs mounts give the non-hugetlb THP case, and
+ * madvise(MADV_POPULATE_WRITE) issued by per-node pinned threads gives
+ * exactly the parallel pre-fault a creation-time flag would, with the
+ * policy already in place.  Placement is a property of who maps the
+ * memory, not of the segment, which is why it lives at attach time.
  */
 static int newseg(struct ipc_namespace *ns, struct ipc_params *params)
 {
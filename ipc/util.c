@@ -549,6 +549,14 @@ void ipc_rcu_putref(struct kern_ipc_perm *ptr,
  * to ipc resources. return 0 if allowed
  *
  * @flag will most probably be 0 or ``S_...UGO`` from <linux/stat.h>
+ *
+ * This must run in full on every operation; a remembered verdict keyed on
+ * the object's sequence number would survive things that are required to
+ * change the answer.  IPC_SET can flip mode/uid/gid without touching the
+ * seq, the calling task's credentials can change between operations,
+ * LSM policy can be reloaded (the hook is already backed by the policy
+ * module's own verdict cache, e.g. the SELinux AVC), and the audit
+ * record emitted below is mandated per call, not per grant.
  */
 int ipcperms(struct ipc_namespace *ns, struct kern_ipc_perm *ipcp, short flag)
 {
@@ -135,6 +135,16 @@ kdb_bt(int argc, const char **argv)
 	/* Prompt after each proc in bta */
 	kdbgetintenv("BTAPROMPT", &btaprompt);
 
+	/*
+	 * 'bta' is necessarily single threaded: the other CPUs are parked in
+	 * the debug core's roundup loop and must stay there, because the
+	 * frozen system state is the very thing being inspected.  Releasing
+	 * them to walk their runqueues in parallel would mean running kernel
+	 * code on a machine we claim is stopped.  In practice the time goes
+	 * to pushing the traces through the (usually serial) console anyway,
+	 * which no amount of parallel collection speeds up; use the state
+	 * mask argument to restrict the walk to the tasks of interest.
+	 */
 	if (strcmp(argv[0], "bta") == 0) {
 		struct task_struct *g, *p;
 		unsigned long cpu;
@@ -36,14 +36,33 @@ static int map_benchmark_thread(void *data)
 	void *buf;
 	dma_addr_t dma_addr;
 	struct map_benchmark_data *map = data;
+	bool batch = map->bparam.map_mode == DMA_MAP_MODE_BATCH;
 	int npages = map->bparam.granule;
 	u64 size = npages * PAGE_SIZE;
+	struct page **pages = NULL;
+	dma_addr_t *addrs = NULL;
+	size_t *sizes = NULL;
 	int ret = 0;
+	int i;
 
 	buf = alloc_pages_exact(size, GFP_KERNEL);
 	if (!buf)
 		return -ENOMEM;
 
+	if (batch) {
+		pages = kmalloc_array(npages, sizeof(*pages), GFP_KERNEL);
+		addrs = kmalloc_array(npages, sizeof(*addrs), GFP_KERNEL);
+		sizes = kmalloc_array(npages, sizeof(*sizes), GFP_KERNEL);
+		if (!pages || !addrs || !sizes) {
+			ret = -ENOMEM;
+			goto out;
+		}
+		for (i = 0; i < npages; i++) {
+			pages[i] = virt_to_page(buf + i * PAGE_SIZE);
+			sizes[i] = PAGE_SIZE;
+		}
+	}
+
 	while (!kthread_should_stop())  {
 		u64 map_100ns, unmap_100ns, map_sq, unmap_sq;
 		ktime_t map_stime, map_etime, unmap_stime, unmap_etime;
@@ -59,12 +78,24 @@ static int map_benchmark_thread(void *data)
 			memset(buf, 0x66, size);
 
 		map_stime = ktime_get();
-		dma_addr = dma_map_single(map->dev, buf, size, map->dir);
-		if (unlikely(dma_mapping_error(map->dev, dma_addr))) {
-			pr_err("dma_map_single failed on %s\n",
-				dev_name(map->dev));
-			ret = -ENOMEM;
-			goto out;
+		if (batch) {
+			if (unlikely(dma_map_batch(map->dev, pages, sizes,
+						   addrs, npages, map->dir,
+						   0))) {
+				pr_err("dma_map_batch failed on %s\n",
+					dev_name(map->dev));
+				ret = -ENOMEM;
+				goto out;
+			}
+		} else {
+			dma_addr = dma_map_single(map->dev, buf, size,
+						  map->dir);
+			if (unlikely(dma_mapping_error(map->dev, dma_addr))) {
+				pr_err("dma_map_single failed on %s\n",
+					dev_name(map->dev));
+				ret = -ENOMEM;
+				goto out;
+			}
 		}
 		map_etime = ktime_get();
 		map_delta = ktime_sub(map_etime, map_stime);
@@ -73,7 +104,11 @@ static int map_benchmark_thread(void *data)
 		ndelay(map->bparam.dma_trans_ns);
 
 		unmap_stime = ktime_get();
-		dma_unmap_single(map->dev, dma_addr, size, map->dir);
+		if (batch)
+			dma_unmap_batch(map->dev, addrs, sizes, npages,
+					map->dir, 0);
+		else
+			dma_unmap_single(map->dev, dma_addr, size, map->dir);
 		unmap_etime = ktime_get();
 		unmap_delta = ktime_sub(unmap_etime, unmap_stime);
 
@@ -108,6 +143,9 @@ static int map_benchmark_thread(void *data)
 	}
 
 out:
+	kfree(sizes);
+	kfree(addrs);
+	kfree(pages);
 	free_pages_exact(buf, size);
 	return ret;
 }
@@ -238,6 +276,12 @@ static long map_benchmark_ioctl(struct file *file, unsigned int cmd,
 			return -EINVAL;
 		}
 
+		if (map->bparam.map_mode != DMA_MAP_MODE_SINGLE &&
+		    map->bparam.map_mode != DMA_MAP_MODE_BATCH) {
+			pr_err("invalid map mode\n");
+			return -EINVAL;
+		}
+
 		switch (map->bparam.dma_dir) {
 		case DMA_MAP_BIDIRECTIONAL:
 			map->dir = DMA_BIDIRECTIONAL;
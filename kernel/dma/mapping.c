@@ -198,6 +198,115 @@ void dma_unmap_page_attrs(struct device *dev, dma_addr_t addr, size_t size,
 }
 EXPORT_SYMBOL(dma_unmap_page_attrs);
 
+/**
+ * dma_unmap_batch - unmap a batch of pages previously mapped with
+ *		     dma_map_batch()
+ * @dev:	device the batch was mapped for
+ * @addrs:	DMA addresses returned by dma_map_batch()
+ * @sizes:	sizes passed to dma_map_batch()
+ * @npages:	number of entries in @addrs and @sizes
+ * @dir:	DMA transfer direction, must match the mapping call
+ * @attrs:	DMA mapping attributes, applied to every unmapping
+ *
+ * Like dma_map_batch(), the mapping path is resolved once and every
+ * fragment then takes the same branch without re-evaluating the indirect
+ * ops dispatch.
+ */
+void dma_unmap_batch(struct device *dev, dma_addr_t *addrs, size_t *sizes,
+		int npages, enum dma_data_direction dir, unsigned long attrs)
+{
+	const struct dma_map_ops *ops = get_dma_ops(dev);
+	bool direct = dma_map_direct(dev, ops);
+	bool iommu = use_dma_iommu(dev);
+	int i;
+
+	BUG_ON(!valid_dma_direction(dir));
+
+	for (i = 0; i < npages; i++) {
+		dma_addr_t addr = addrs[i];
+		size_t size = sizes[i];
+
+		if (direct || arch_dma_unmap_page_direct(dev, addr + size))
+			dma_direct_unmap_page(dev, addr, size, dir, attrs);
+		else if (iommu)
+			iommu_dma_unmap_page(dev, addr, size, dir, attrs);
+		else
+			ops->unmap_page(dev, addr, size, dir, attrs);
+		trace_dma_unmap_page(dev, addr, size, dir, attrs);
+		debug_dma_unmap_page(dev, addr, size, dir);
+	}
+}
+EXPORT_SYMBOL_GPL(dma_unmap_batch);
+
+/**
+ * dma_map_batch - map an array of pages for streaming DMA
+ * @dev:	device the mappings are created for
+ * @pages:	pages to be mapped
+ * @sizes:	number of bytes to map from the start of each page
+ * @addrs:	filled with the DMA address of each mapping on success
+ * @npages:	number of entries in @pages, @sizes and @addrs
+ * @dir:	DMA transfer direction
+ * @attrs:	DMA mapping attributes, applied to every mapping
+ *
+ * Map each page in @pages for DMA to or from @dev. The mapping path
+ * (direct mapping, IOMMU or indirect dma_map_ops call) is resolved once
+ * for the whole batch, so callers that map many fragments at once do not
+ * pay the indirect dispatch per fragment.
+ *
+ * If mapping a fragment fails, all fragments mapped so far by this call
+ * are unmapped again and no entry of @addrs is valid.
+ *
+ * Return: 0 on success, or -ENOMEM if mapping a fragment failed.
+ */
+int dma_map_batch(struct device *dev, struct page **pages, size_t *sizes,
+		dma_addr_t *addrs, int npages, enum dma_data_direction dir,
+		unsigned long attrs)
+{
+	const struct dma_map_ops *ops = get_dma_ops(dev);
+	bool direct, iommu;
+	int i;
+
+	BUG_ON(!valid_dma_direction(dir));
+
+	if (WARN_ON_ONCE(!dev->dma_mask))
+		return -ENOMEM;
+
+	direct = dma_map_direct(dev, ops);
+	iommu = use_dma_iommu(dev);
+
+	for (i = 0; i < npages; i++) {
+		struct page *page = pages[i];
+		size_t size = sizes[i];
+		dma_addr_t addr;
+
+		if (direct ||
+		    arch_dma_map_page_direct(dev, page_to_phys(page) + size))
+			addr = dma_direct_map_page(dev, page, 0, size, dir,
+						   attrs);
+		else if (iommu)
+			addr = iommu_dma_map_page(dev, page, 0, size, dir,
+						  attrs);
+		else
+			addr = ops->map_page(dev, page, 0, size, dir, attrs);
+		if (dma_mapping_error(dev, addr))
+			goto out_unmap;
+
+		addrs[i] = addr;
+		kmsan_handle_dma(page, 0, size, dir);
+		trace_dma_map_page(dev, page_to_phys(page), addr, size, dir,
+				   attrs);
+		debug_dma_map_page(dev, page, 0, size, dir, addr, attrs);
+	}
+
+	return 0;
+
+out_unmap:
+	dma_unmap_batch(dev, addrs, sizes, i, dir,
+			attrs | DMA_ATTR_SKIP_CPU_SYNC);
+	return -ENOMEM;
+}
+EXPORT_SYMBOL_GPL(dma_map_batch);
+
 static int __dma_map_sg_attrs(struct device *dev, struct scatterlist *sg,
 	 int nents, enum dma_data_direction dir, unsigned long attrs)
 {
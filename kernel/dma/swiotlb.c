@@ -91,6 +91,7 @@ static struct io_tlb_mem io_tlb_default_mem = {
 	.pools = LIST_HEAD_INIT(io_tlb_default_mem.pools),
 	.dyn_alloc = __WORK_INITIALIZER(io_tlb_default_mem.dyn_alloc,
 					swiotlb_dyn_alloc),
+	.alloc_nid = ATOMIC_INIT(NUMA_NO_NODE),
 };
 
 #else  /* !CONFIG_SWIOTLB_DYNAMIC */
@@ -295,6 +296,9 @@ static void swiotlb_init_io_tlb_pool(struct io_tlb_pool *mem, phys_addr_t start,
 
 	memset(vaddr, 0, bytes);
 	mem->vaddr = vaddr;
+#ifdef CONFIG_SWIOTLB_DYNAMIC
+	mem->nid = NUMA_NO_NODE;
+#endif
 	return;
 }
 
@@ -562,6 +566,7 @@ void __init swiotlb_exit(void)
 /**
  * alloc_dma_pages() - allocate pages to be used for DMA
  * @gfp:	GFP flags for the allocation.
+ * @nid:	Preferred NUMA node, or %NUMA_NO_NODE for no preference.
  * @bytes:	Size of the buffer.
  * @phys_limit:	Maximum allowed physical address of the buffer.
  *
@@ -571,14 +576,15 @@ void __init swiotlb_exit(void)
  * Return: Decrypted pages, %NULL on allocation failure, or ERR_PTR(-EAGAIN)
  * if the allocated physical address was above @phys_limit.
  */
-static struct page *alloc_dma_pages(gfp_t gfp, size_t bytes, u64 phys_limit)
+static struct page *alloc_dma_pages(gfp_t gfp, int nid, size_t bytes,
+		u64 phys_limit)
 {
 	unsigned int order = get_order(bytes);
 	struct page *page;
 	phys_addr_t paddr;
 	void *vaddr;
 
-	page = alloc_pages(gfp, order);
+	page = alloc_pages_node(nid, gfp, order);
 	if (!page)
 		return NULL;
 
@@ -605,12 +611,13 @@ error:
  * @dev:	Device for which a memory pool is allocated.
  * @bytes:	Size of the buffer.
  * @phys_limit:	Maximum allowed physical address of the buffer.
+ * @nid:	Preferred NUMA node, or %NUMA_NO_NODE for no preference.
  * @gfp:	GFP flags for the allocation.
  *
  * Return: Allocated pages, or %NULL on allocation failure.
  */
 static struct page *swiotlb_alloc_tlb(struct device *dev, size_t bytes,
-		u64 phys_limit, gfp_t gfp)
+		u64 phys_limit, int nid, gfp_t gfp)
 {
 	struct page *page;
 
@@ -634,7 +641,7 @@ static struct page *swiotlb_alloc_tlb(struct device *dev, size_t bytes,
 	else if (phys_limit <= DMA_BIT_MASK(32))
 		gfp |= __GFP_DMA32;
 
-	while (IS_ERR(page = alloc_dma_pages(gfp, bytes, phys_limit))) {
+	while (IS_ERR(page = alloc_dma_pages(gfp, nid, bytes, phys_limit))) {
 		if (IS_ENABLED(CONFIG_ZONE_DMA32) &&
 		    phys_limit < DMA_BIT_MASK(64) &&
 		    !(gfp & (__GFP_DMA32 | __GFP_DMA)))
@@ -671,6 +678,8 @@ static void swiotlb_free_tlb(void *vaddr, size_t bytes)
  * @minslabs:	Minimum number of slabs.
  * @nslabs:	Desired (maximum) number of slabs.
  * @nareas:	Number of areas.
+ * @nid:	Preferred NUMA node for the pool memory, or %NUMA_NO_NODE
+ *		for no preference.
  * @phys_limit:	Maximum DMA buffer physical address.
  * @gfp:	GFP flags for the allocations.
  *
@@ -682,7 +691,7 @@ static void swiotlb_free_tlb(void *vaddr, size_t bytes)
  */
 static struct io_tlb_pool *swiotlb_alloc_pool(struct device *dev,
 		unsigned long minslabs, unsigned long nslabs,
-		unsigned int nareas, u64 phys_limit, gfp_t gfp)
+		unsigned int nareas, int nid, u64 phys_limit, gfp_t gfp)
 {
 	struct io_tlb_pool *pool;
 	unsigned int slot_order;
@@ -696,13 +705,13 @@ static struct io_tlb_pool *swiotlb_alloc_pool(struct device *dev,
 	}
 
 	pool_size = sizeof(*pool) + array_size(sizeof(*pool->areas), nareas);
-	pool = kzalloc(pool_size, gfp);
+	pool = kzalloc_node(pool_size, gfp, nid);
 	if (!pool)
 		goto error;
 	pool->areas = (void *)pool + sizeof(*pool);
 
 	tlb_size = nslabs << IO_TLB_SHIFT;
-	while (!(tlb = swiotlb_alloc_tlb(dev, tlb_size, phys_limit, gfp))) {
+	while (!(tlb = swiotlb_alloc_tlb(dev, tlb_size, phys_limit, nid, gfp))) {
 		if (nslabs <= minslabs)
 			goto error_tlb;
 		nslabs = ALIGN(nslabs >> 1, IO_TLB_SEGSIZE);
@@ -717,6 +726,7 @@ static struct io_tlb_pool *swiotlb_alloc_pool(struct device *dev,
 		goto error_slots;
 
 	swiotlb_init_io_tlb_pool(pool, page_to_phys(tlb), nslabs, true, nareas);
+	pool->nid = nid;
 	return pool;
 
 error_slots:
@@ -736,9 +746,19 @@ static void swiotlb_dyn_alloc(struct work_struct *work)
 	struct io_tlb_mem *mem =
 		container_of(work, struct io_tlb_mem, dyn_alloc);
 	struct io_tlb_pool *pool;
+	int nid;
+
+	/*
+	 * Grow the pool on the node of the device which most recently ran
+	 * out of slots. This is only a hint; if several devices on
+	 * different nodes are starved at the same time, the losers retry
+	 * with another worker invocation.
+	 */
+	nid = atomic_xchg(&mem->alloc_nid, NUMA_NO_NODE);
 
 	pool = swiotlb_alloc_pool(NULL, IO_TLB_MIN_SLABS, default_nslabs,
-				  default_nareas, mem->phys_limit, GFP_KERNEL);
+				  default_nareas, nid, mem->phys_limit,
+				  GFP_KERNEL);
 	if (!pool) {
 		pr_warn_ratelimited("Failed to allocate new pool");
 		return;
@@ -1127,6 +1147,8 @@ found:
  * @dev:	Device which maps the buffer.
  * @start_cpu:	Start CPU number.
  * @cpu_offset:	Offset from @start_cpu.
+ * @nid:	Consider only pools allocated from this NUMA node;
+ *		%NUMA_NO_NODE considers all pools.
  * @orig_addr:	Original (non-bounced) IO buffer address.
  * @alloc_size: Total requested size of the bounce buffer,
  *		including initial alignment padding.
@@ -1139,8 +1161,9 @@ found:
  * Return: Index of the first allocated slot, or -1 on error.
  */
 static int swiotlb_search_area(struct device *dev, int start_cpu,
-		int cpu_offset, phys_addr_t orig_addr, size_t alloc_size,
-		unsigned int alloc_align_mask, struct io_tlb_pool **retpool)
+		int cpu_offset, int nid, phys_addr_t orig_addr,
+		size_t alloc_size, unsigned int alloc_align_mask,
+		struct io_tlb_pool **retpool)
 {
 	struct io_tlb_mem *mem = dev->dma_io_tlb_mem;
 	struct io_tlb_pool *pool;
@@ -1149,6 +1172,8 @@ static int swiotlb_search_area(struct device *dev, int start_cpu,
 
 	rcu_read_lock();
 	list_for_each_entry_rcu(pool, &mem->pools, node) {
+		if (nid != NUMA_NO_NODE && pool->nid != nid)
+			continue;
 		if (cpu_offset >= pool->nareas)
 			continue;
 		area_index = (start_cpu + cpu_offset) & (pool->nareas - 1);
@@ -1183,6 +1208,7 @@ static int swiotlb_find_slots(struct device *dev, phys_addr_t orig_addr,
 		struct io_tlb_pool **retpool)
 {
 	struct io_tlb_mem *mem = dev->dma_io_tlb_mem;
+	int nid = dev_to_node(dev);
 	struct io_tlb_pool *pool;
 	unsigned long nslabs;
 	unsigned long flags;
@@ -1193,9 +1219,23 @@ static int swiotlb_find_slots(struct device *dev, phys_addr_t orig_addr,
 	if (alloc_size > IO_TLB_SEGSIZE * IO_TLB_SIZE)
 		return -1;
 
+	/*
+	 * Prefer pools backed by the node of the device to keep the bounce
+	 * buffer traffic local, then fall back to pools on any node.
+	 */
 	cpu = raw_smp_processor_id();
+	if (nid != NUMA_NO_NODE) {
+		for (i = 0; i < default_nareas; ++i) {
+			index = swiotlb_search_area(dev, cpu, i, nid,
+						    orig_addr, alloc_size,
+						    alloc_align_mask, &pool);
+			if (index >= 0)
+				goto found;
+		}
+	}
 	for (i = 0; i < default_nareas; ++i) {
-		index = swiotlb_search_area(dev, cpu, i, orig_addr, alloc_size,
+		index = swiotlb_search_area(dev, cpu, i, NUMA_NO_NODE,
+					    orig_addr, alloc_size,
 					    alloc_align_mask, &pool);
 		if (index >= 0)
 			goto found;
@@ -1204,11 +1244,12 @@ static int swiotlb_find_slots(struct device *dev, phys_addr_t orig_addr,
 	if (!mem->can_grow)
 		return -1;
 
+	atomic_set(&mem->alloc_nid, nid);
 	schedule_work(&mem->dyn_alloc);
 
 	nslabs = nr_slots(alloc_size);
 	phys_limit = min_not_zero(*dev->dma_mask, dev->bus_dma_limit);
-	pool = swiotlb_alloc_pool(dev, nslabs, nslabs, 1, phys_limit,
+	pool = swiotlb_alloc_pool(dev, nslabs, nslabs, 1, nid, phys_limit,
 				  GFP_NOWAIT | __GFP_NOWARN);
 	if (!pool)
 		return -1;
@@ -1839,6 +1880,7 @@ static int rmem_swiotlb_device_init(struct reserved_mem *rmem,
 #ifdef CONFIG_SWIOTLB_DYNAMIC
 		spin_lock_init(&mem->lock);
 		INIT_LIST_HEAD_RCU(&mem->pools);
+		atomic_set(&mem->alloc_nid, NUMA_NO_NODE);
 #endif
 		add_mem_pool(mem, pool);
 
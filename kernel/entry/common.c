@@ -25,6 +25,17 @@ static inline void syscall_enter_audit(struct pt_regs *regs, long syscall)
 	}
 }
 
+/*
+ * This is the slow path: the caller has already tested the task's
+ * SYSCALL_WORK bitmask and tasks with no work never get here.  Within
+ * it, the per-flag branches cannot be specialized per syscall number
+ * ahead of time - seccomp's verdict for a given syscall is computed by
+ * the attached BPF program at run time, ptrace reports every syscall by
+ * definition, and audit decides against its rule set - so there is no
+ * flag-change moment at which a per-syscall work chain could be
+ * precompiled.  Static calls would not help either; they patch kernel
+ * text globally and cannot express per-task state.
+ */
 long syscall_trace_enter(struct pt_regs *regs, long syscall,
 				unsigned long work)
 {
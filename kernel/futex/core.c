@@ -107,21 +107,133 @@ late_initcall(fail_futex_debugfs);
 
 #endif /* CONFIG_FAIL_FUTEX */
 
+/*
+ * Opt-in private futex hash table.
+ *
+ * Processes with many threads land their hot private futexes in the global
+ * bucket array, where they false-share buckets and bucket locks with
+ * unrelated processes. A process can request its own bucket array via
+ * prctl(PR_FUTEX_HASH, PR_FUTEX_HASH_SET_SLOTS, slots). The table is
+ * published once, stays immutable until the mm is torn down and is only
+ * consulted for private futex keys, so the lookup fast path pays no more
+ * than one extra load.
+ */
+struct futex_private_hash {
+	unsigned int hash_mask;
+	struct futex_hash_bucket queues[];
+};
+
+#define FUTEX_PRIVATE_HASH_SLOTS_MAX	131072
+
+static void futex_hash_bucket_init(struct futex_hash_bucket *fhb)
+{
+	atomic_set(&fhb->waiters, 0);
+	plist_head_init(&fhb->chain);
+	spin_lock_init(&fhb->lock);
+}
+
 /**
- * futex_hash - Return the hash bucket in the global hash
+ * futex_hash - Return the hash bucket for a futex key
  * @key:	Pointer to the futex key for which the hash is calculated
  *
  * We hash on the keys returned from get_futex_key (see below) and return the
- * corresponding hash bucket in the global hash.
+ * corresponding hash bucket in the owning process' private hash, if it has
+ * set one up and the key is process private, or in the global hash otherwise.
  */
 struct futex_hash_bucket *futex_hash(union futex_key *key)
 {
 	u32 hash = jhash2((u32 *)key, offsetof(typeof(*key), both.offset) / 4,
 			  key->both.offset);
 
+	if (!(key->both.offset & (FUT_OFF_INODE | FUT_OFF_MMSHARED))) {
+		struct futex_private_hash *fph;
+
+		/* Pairs with smp_store_release() in futex_hash_allocate(). */
+		fph = smp_load_acquire(&key->private.mm->futex_phash);
+		if (fph)
+			return &fph->queues[hash & fph->hash_mask];
+	}
+
 	return &futex_queues[hash & (futex_hashsize - 1)];
 }
 
+/**
+ * futex_hash_free - Free the private hash table of an mm
+ * @mm:		The mm being torn down
+ *
+ * Must be called from __mmdrop(), when no user of @mm is left and thus no
+ * waiter can sit in one of the private buckets anymore. Until that call is
+ * wired up, an installed table outlives its mm.
+ */
+void futex_hash_free(struct mm_struct *mm)
+{
+	kvfree(mm->futex_phash);
+}
+
+static int futex_hash_allocate(unsigned int slots)
+{
+	struct mm_struct *mm = current->mm;
+	struct futex_private_hash *fph;
+	unsigned int i;
+
+	if (!slots)
+		slots = clamp(roundup_pow_of_two(4 * num_possible_cpus()),
+			      16UL, (unsigned long)FUTEX_PRIVATE_HASH_SLOTS_MAX);
+
+	if (slots > FUTEX_PRIVATE_HASH_SLOTS_MAX || !is_power_of_2(slots))
+		return -EINVAL;
+
+	/*
+	 * Waiters already queued in the global hash are not rehashed. The
+	 * table may therefore only be installed while no other thread of
+	 * this process can block on a private futex, i.e. while the
+	 * process is single threaded, and only once.
+	 */
+	if (atomic_read(&mm->mm_users) > 1)
+		return -EBUSY;
+	if (mm->futex_phash)
+		return -EBUSY;
+
+	fph = kvzalloc(struct_size(fph, queues, slots), GFP_KERNEL_ACCOUNT);
+	if (!fph)
+		return -ENOMEM;
+
+	fph->hash_mask = slots - 1;
+	for (i = 0; i < slots; i++)
+		futex_hash_bucket_init(&fph->queues[i]);
+
+	/* Pairs with the smp_load_acquire() in futex_hash(). */
+	smp_store_release(&mm->futex_phash, fph);
+	return 0;
+}
+
+/**
+ * futex_hash_prctl - Handle prctl(PR_FUTEX_HASH)
+ * @arg2:	Sub-command, %PR_FUTEX_HASH_SET_SLOTS or
+ *		%PR_FUTEX_HASH_GET_SLOTS
+ * @arg3:	Number of slots for SET_SLOTS; 0 selects a default based on
+ *		the number of possible CPUs
+ *
+ * Entry point for the %PR_FUTEX_HASH dispatch in sys_prctl(); unreachable
+ * until that dispatch is wired up.
+ */
+int futex_hash_prctl(unsigned long arg2, unsigned long arg3)
+{
+	struct futex_private_hash *fph;
+
+	switch (arg2) {
+	case PR_FUTEX_HASH_SET_SLOTS:
+		if (arg3 > FUTEX_PRIVATE_HASH_SLOTS_MAX)
+			return -EINVAL;
+		return futex_hash_allocate(arg3);
+	case PR_FUTEX_HASH_GET_SLOTS:
+		fph = current->mm->futex_phash;
+		return fph ? fph->hash_mask + 1 : 0;
+	default:
+		return -EINVAL;
+	}
+}
+
 
 /**
  * futex_setup_timer - set up the sleeping hrtimer.
@@ -1142,11 +1254,8 @@ static int __init futex_init(void)
 					       futex_hashsize, futex_hashsize);
 	futex_hashsize = 1UL << futex_shift;
 
-	for (i = 0; i < futex_hashsize; i++) {
-		atomic_set(&futex_queues[i].waiters, 0);
-		plist_head_init(&futex_queues[i].chain);
-		spin_lock_init(&futex_queues[i].lock);
-	}
+	for (i = 0; i < futex_hashsize; i++)
+		futex_hash_bucket_init(&futex_queues[i]);
 
 	return 0;
 }
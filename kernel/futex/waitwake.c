@@ -1,9 +1,11 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <linux/plist.h>
+#include <linux/sched/clock.h>
 #include <linux/sched/task.h>
 #include <linux/sched/signal.h>
 #include <linux/freezer.h>
+#include <linux/sysctl.h>
 
 #include "futex.h"
 
@@ -643,6 +645,79 @@ retry_private:
 	return ret;
 }
 
+/*
+ * Opt-in spin before sleeping in futex_wait().
+ *
+ * With sub-microsecond lock hold times the queue/schedule/wakeup round
+ * trip dominates the handoff latency. When futex_wait_spin_ns is
+ * non-zero, futex_wait() first spins on the futex word for at most that
+ * long before queueing on the hash bucket. The spin is abandoned as soon
+ * as this CPU has other work to run, so it cannot delay the presumed
+ * lock owner.
+ */
+static unsigned int futex_wait_spin_ns;
+
+#ifdef CONFIG_SYSCTL
+static unsigned int futex_wait_spin_ns_max = 100000;
+
+static const struct ctl_table futex_wait_sysctls[] = {
+	{
+		.procname	= "futex_wait_spin_ns",
+		.data		= &futex_wait_spin_ns,
+		.maxlen		= sizeof(futex_wait_spin_ns),
+		.mode		= 0644,
+		.proc_handler	= proc_douintvec_minmax,
+		.extra1		= SYSCTL_ZERO,
+		.extra2		= &futex_wait_spin_ns_max,
+	},
+};
+
+static int __init futex_wait_sysctl_init(void)
+{
+	register_sysctl_init("kernel", futex_wait_sysctls);
+	return 0;
+}
+late_initcall(futex_wait_sysctl_init);
+#endif
+
+/**
+ * futex_wait_spin() - spin on the futex word before queueing
+ * @uaddr:	futex user address
+ * @flags:	futex flags as for futex_wait()
+ * @val:	expected value
+ *
+ * Spin while @uaddr still contains @val, i.e. while a wakeup is not to be
+ * expected anyway, for at most futex_wait_spin_ns nanoseconds. Only
+ * process-private futexes are spun on; for shared futexes the waker may
+ * run in another address space and the value check below could not use
+ * the fast pagefault-disabled access.
+ *
+ * Return:
+ *  -  0		- spin budget exhausted or not eligible; queue normally
+ *  -  -EWOULDBLOCK	- the futex word changed while spinning
+ */
+static int futex_wait_spin(u32 __user *uaddr, unsigned int flags, u32 val)
+{
+	u64 end;
+	u32 uval;
+
+	if (!READ_ONCE(futex_wait_spin_ns) || (flags & FLAGS_SHARED))
+		return 0;
+
+	end = sched_clock() + READ_ONCE(futex_wait_spin_ns);
+	do {
+		if (futex_get_value_locked(&uval, uaddr))
+			return 0;
+		if (uval != val)
+			return -EWOULDBLOCK;
+		if (need_resched() || signal_pending(current))
+			return 0;
+		cpu_relax();
+	} while (sched_clock() < end);
+
+	return 0;
+}
+
 int __futex_wait(u32 __user *uaddr, unsigned int flags, u32 val,
 		 struct hrtimer_sleeper *to, u32 bitset)
 {
@@ -655,6 +730,10 @@ int __futex_wait(u32 __user *uaddr, unsigned int flags, u32 val,
 
 	q.bitset = bitset;
 
+	ret = futex_wait_spin(uaddr, flags, val);
+	if (ret)
+		return ret;
+
 retry:
 	/*
 	 * Prepare to wait on uaddr. On success, it holds hb->lock and q
@@ -13,6 +13,16 @@
  *		 Peter Oberparleiter <oberpar@linux.vnet.ibm.com>
  *		 Paul Larson
  *		 Yi CDL Yang
+ *
+ * The one-debugfs-file-per-object layout is the interface contract: each
+ * file serializes to the exact .gcda format of its translation unit so
+ * that unmodified gcov/lcov tooling can consume it.  A combined stream
+ * would need its own userspace decoder and would still serialize the same
+ * counter data, so it moves cost around rather than removing it; bulk
+ * harvest is a packaging problem for the reader (e.g. tar over the tree).
+ * Delta extraction is likewise available without kernel state: write to
+ * the 'reset' file after a harvest and subsequent reads are
+ * since-last-reset.
  */
 
 #define pr_fmt(fmt)	"gcov: " fmt
@@ -8,6 +8,7 @@
 #include <linux/slab.h>
 #include <linux/cpu.h>
 #include <linux/group_cpus.h>
+#include <linux/topology.h>
 
 static void default_calc_sets(struct irq_affinity *affd, unsigned int affvecs)
 {
@@ -15,6 +16,89 @@ static void default_calc_sets(struct irq_affinity *affd, unsigned int affvecs)
 	affd->set_size[0] = affvecs;
 }
 
+/*
+ * Managed affinity spreading policy:
+ *
+ * group_cpus_evenly() balances vectors over nodes and CPUs but knows
+ * nothing about SMT siblings, so with more vectors than physical cores it
+ * can hand two vectors the sibling threads of one core while a
+ * neighbouring cache complex sits idle. "irqaffinity_spread=cache"
+ * rebuilds the managed masks so that every vector owns a distinct
+ * physical core before any core contributes its second thread.
+ */
+static bool irq_affinity_cache_spread __ro_after_init;
+
+static int __init irq_affinity_spread_setup(char *str)
+{
+	if (!strcmp(str, "cache"))
+		irq_affinity_cache_spread = true;
+	else if (!strcmp(str, "flat"))
+		irq_affinity_cache_spread = false;
+	else
+		pr_warn("irqaffinity_spread: unknown policy '%s'\n", str);
+	return 1;
+}
+__setup("irqaffinity_spread=", irq_affinity_spread_setup);
+
+/*
+ * Rebuild the masks of @numvecs managed vectors starting at @first so
+ * that core leaders (the first SMT thread of each core) are handed out
+ * round robin over the vectors and the remaining sibling threads follow
+ * the vector owning their core. Cores are visited in enumeration order,
+ * which walks successive cache domains on all sane topologies.
+ *
+ * Skipped when there are fewer present cores than vectors, as the
+ * rebuild could otherwise leave vectors with an empty mask.
+ */
+static void irq_spread_cache_aware(struct irq_affinity_desc *masks,
+				   unsigned int first, unsigned int numvecs)
+{
+	unsigned int cpu, leader, ncores = 0, v = 0;
+	unsigned int *core_vec;
+
+	core_vec = kmalloc_array(nr_cpu_ids, sizeof(*core_vec), GFP_KERNEL);
+	if (!core_vec)
+		return;
+	for (cpu = 0; cpu < nr_cpu_ids; cpu++)
+		core_vec[cpu] = UINT_MAX;
+
+	cpus_read_lock();
+
+	for_each_present_cpu(cpu) {
+		if (cpu == cpumask_first(topology_sibling_cpumask(cpu)))
+			ncores++;
+	}
+	if (ncores < numvecs)
+		goto out;
+
+	for (v = 0; v < numvecs; v++)
+		cpumask_clear(&masks[first + v].mask);
+
+	/* First pass: one distinct core per vector, round robin. */
+	v = 0;
+	for_each_present_cpu(cpu) {
+		if (cpu != cpumask_first(topology_sibling_cpumask(cpu)))
+			continue;
+		core_vec[cpu] = first + v;
+		cpumask_set_cpu(cpu, &masks[first + v].mask);
+		v = (v + 1) % numvecs;
+	}
+
+	/* Second pass: SMT siblings follow their core leader's vector. */
+	for_each_present_cpu(cpu) {
+		leader = cpumask_first(topology_sibling_cpumask(cpu));
+		if (cpu == leader)
+			continue;
+		if (core_vec[leader] != UINT_MAX)
+			cpumask_set_cpu(cpu, &masks[core_vec[leader]].mask);
+		else
+			cpumask_set_cpu(cpu, &masks[first].mask);
+	}
+out:
+	cpus_read_unlock();
+	kfree(core_vec);
+}
+
 /**
  * irq_create_affinity_masks - Create affinity masks for multiqueue spreading
  * @nvecs:	The total number of vectors
@@ -82,6 +166,9 @@ irq_create_affinity_masks(unsigned int nvecs, struct irq_affinity *affd)
 			cpumask_copy(&masks[curvec + j].mask, &result[j]);
 		kfree(result);
 
+		if (irq_affinity_cache_spread)
+			irq_spread_cache_aware(masks, curvec, this_vecs);
+
 		curvec += this_vecs;
 		usedvecs += this_vecs;
 	}
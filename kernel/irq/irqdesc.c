@@ -446,6 +446,15 @@ static void irq_sysfs_del(struct irq_desc *desc) {}
 
 #endif /* CONFIG_SYSFS */
 
+/*
+ * This lookup is already lock-free: mtree_load() walks the maple tree under
+ * RCU and never touches sparse_irq_lock, which serializes only descriptor
+ * allocation/free and the procfs iterators.  It is also off the interrupt
+ * hot path: interrupt entry resolves descriptors through the irqdomain
+ * revmap (irq_resolve_mapping()), not through the Linux irq number, so a
+ * per-CPU translation cache here would add invalidation machinery without
+ * removing work from interrupt delivery.
+ */
 struct irq_desc *irq_to_desc(unsigned int irq)
 {
 	return mtree_load(&sparse_irqs, irq);
@@ -379,6 +379,18 @@ void irq_matrix_remove_reserved(struct irq_matrix *m)
  * @msk:	Which CPUs to search in
  * @reserved:	Allocate previously reserved interrupts
  * @mapped_cpu: Pointer to store the CPU for which the irq was allocated
+ *
+ * The matrix has no locking of its own; the architecture caller serializes
+ * all matrix operations (on x86 under vector_lock).  Single-vector
+ * allocation is deliberate: the best-CPU choice depends on the occupancy
+ * changes made by the previous allocation, so a batch of N vectors under
+ * one lock acquisition would run the same scan N times anyway, and each
+ * vector must still be programmed into the hardware individually by the
+ * caller.  The spread across CPUs comes from re-evaluating
+ * matrix_find_best_cpu() per vector, not from a precomputed candidate
+ * list.  Lazy bulk setup is covered by the reservation mechanism
+ * (irq_matrix_reserve_managed()/irq_matrix_reserve()), which claims space
+ * without picking vectors until activation.
  */
 int irq_matrix_alloc(struct irq_matrix *m, const struct cpumask *msk,
 		     bool reserved, unsigned int *mapped_cpu)
@@ -1219,6 +1219,18 @@ static int msi_init_virq(struct irq_domain *domain, int virq, unsigned int vflag
 	return 0;
 }
 
+/*
+ * Descriptors are materialized in bulk before this runs (see
+ * msi_domain_add_simple_msi_descs()), but the hierarchy allocation below is
+ * intentionally one __irq_domain_alloc_irqs() call per descriptor: each
+ * MSI-X entry carries its own affinity descriptor and per-domain chip data,
+ * which the allocation arguments encode per call.  Multi-MSI is the one
+ * case where vectors must be contiguous, and it is already batched through
+ * desc->nvec_used.  The expensive part of provisioning large vector counts,
+ * claiming real CPU vectors, is deferred anyway: in reservation mode
+ * (VIRQ_CAN_RESERVE) a freshly allocated interrupt only holds a reserved
+ * slot and does not consume or program a device vector until request_irq().
+ */
 static int __msi_domain_alloc_irqs(struct device *dev, struct irq_domain *domain,
 				   struct msi_ctrl *ctrl)
 {
@@ -12,6 +12,7 @@
 #include <linux/irq.h>
 #include <linux/math64.h>
 #include <linux/log2.h>
+#include <linux/sched/clock.h>
 
 #include <trace/events/irq.h>
 
@@ -592,6 +593,84 @@ u64 irq_timings_next_event(u64 now)
 	return next_evt;
 }
 
+/**
+ * irq_timings_next_irq - Predict the next occurrence of one interrupt
+ * @irq: the interrupt number
+ * @now: current time
+ *
+ * Flush the pending per-CPU timing samples into the statistical model
+ * and return a prediction for the next occurrence of @irq on this CPU,
+ * based on the repeating patterns and the exponential moving average of
+ * its past inter-arrival times.
+ *
+ * This function must be called with the local irq disabled in order to
+ * prevent the timings circular buffer from being updated while we are
+ * reading it.
+ *
+ * Returns a nanosec time based estimation of the next interrupt,
+ * U64_MAX if there is no model for @irq (yet).
+ */
+u64 irq_timings_next_irq(unsigned int irq, u64 now)
+{
+	struct irq_timings *irqts = this_cpu_ptr(&irq_timings);
+	struct irqt_stat __percpu *s;
+	u64 ts;
+	int i;
+
+	lockdep_assert_irqs_disabled();
+
+	/*
+	 * Consume the samples accumulated since the last prediction,
+	 * exactly as irq_timings_next_event() does for the idle
+	 * prediction. The buffer is per-CPU, so samples of other
+	 * interrupts must be folded in along the way anyway.
+	 */
+	for_each_irqts(i, irqts) {
+		int sirq = irq_timing_decode(irqts->values[i], &ts);
+
+		s = idr_find(&irqt_stats, sirq);
+		if (s)
+			irq_timings_store(sirq, this_cpu_ptr(s), ts);
+	}
+
+	s = idr_find(&irqt_stats, irq);
+	if (!s)
+		return U64_MAX;
+
+	return __irq_timings_next_event(this_cpu_ptr(s), irq, now);
+}
+EXPORT_SYMBOL_GPL(irq_timings_next_irq);
+
+/**
+ * irq_timings_expect_within - Check whether an interrupt is imminent
+ * @irq: the interrupt number
+ * @delta_ns: the coalescing horizon in nanoseconds
+ *
+ * Helper for software interrupt coalescing: a handler that has just
+ * consumed its completions can ask whether the model predicts the next
+ * occurrence of @irq within @delta_ns and, if so, hold off re-arming
+ * the interrupt and poll for the follow-up work instead.
+ *
+ * Returns true if the next occurrence of @irq is predicted within
+ * @delta_ns from now, false if it is predicted later or not at all.
+ */
+bool irq_timings_expect_within(unsigned int irq, u64 delta_ns)
+{
+	unsigned long flags;
+	u64 now, next;
+
+	local_irq_save(flags);
+	now = local_clock();
+	next = irq_timings_next_irq(irq, now);
+	local_irq_restore(flags);
+
+	if (next == U64_MAX)
+		return false;
+
+	return next <= now + delta_ns;
+}
+EXPORT_SYMBOL_GPL(irq_timings_expect_within);
+
 void irq_timings_free(int irq)
 {
 	struct irqt_stat __percpu *s;
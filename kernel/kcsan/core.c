@@ -99,6 +99,13 @@ static DEFINE_PER_CPU(struct kcsan_ctx, kcsan_cpu_ctx) = {
  *
  * Add NUM_SLOTS-1 entries to account for overflow; this helps avoid having to
  * use more complicated SLOT_IDX_FAST calculation with modulo in the fast-path.
+ *
+ * The array is deliberately global, not per-CPU: a data race is only detected
+ * when a *different* CPU's access finds the watchpoint set up by the stalled
+ * CPU, so watchpoints must be visible to all CPUs via a single address-indexed
+ * table.  Runtime overhead is instead tuned through the skip_watch and
+ * udelay_* module parameters (writable at runtime), which bound how often a
+ * CPU sets up a watchpoint and how long it stalls on one.
  */
 static atomic_long_t watchpoints[CONFIG_KCSAN_NUM_WATCHPOINTS + NUM_SLOTS-1];
 
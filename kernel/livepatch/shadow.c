@@ -40,6 +40,10 @@ static DEFINE_HASHTABLE(klp_shadow_hash, 12);
 /*
  * klp_shadow_lock provides exclusive access to the klp_shadow_hash and
  * the shadow variables it references.
+ *
+ * Only allocation and free paths take this lock; klp_shadow_get() runs
+ * lock-free under RCU, so lookup scalability is bounded by the hash
+ * distribution across the 2^12 buckets rather than by lock contention.
  */
 static DEFINE_SPINLOCK(klp_shadow_lock);
 
@@ -447,6 +447,14 @@ static void klp_send_signals(void)
  * switched yet.
  *
  * If any tasks are still stuck in the initial patch state, schedule a retry.
+ *
+ * Note that this walk is a fallback, not the primary transition mechanism.
+ * Most tasks converge event-driven: klp_start_transition() sets
+ * TIF_PATCH_PENDING once per task and klp_update_patch_state() clears it at
+ * the task's next safe scheduling boundary without any rescanning.  The
+ * periodic walk below exists only for tasks that never cross such a boundary
+ * (long sleepers, idle CPUs), which can only be proven safe by checking
+ * their stacks while they sleep.
  */
 void klp_try_complete_transition(void)
 {
@@ -205,6 +205,7 @@ extern atomic_long_t total_mod_size;
 extern atomic_long_t total_text_size;
 extern atomic_long_t invalid_kread_bytes;
 extern atomic_long_t invalid_decompress_bytes;
+extern atomic_long_t total_decompress_time_us;
 
 extern atomic_t modcount;
 extern atomic_t failed_kreads;
@@ -356,6 +357,7 @@ static inline void kmemleak_load_module(const struct module *mod,
 void init_build_id(struct module *mod, const struct load_info *info);
 void layout_symtab(struct module *mod, struct load_info *info);
 void add_kallsyms(struct module *mod, const struct load_info *info);
+void free_kallsyms_name_index(struct module *mod);
 
 static inline bool sect_empty(const Elf_Shdr *sect)
 {
@@ -365,6 +367,7 @@ static inline bool sect_empty(const Elf_Shdr *sect)
 static inline void init_build_id(struct module *mod, const struct load_info *info) { }
 static inline void layout_symtab(struct module *mod, struct load_info *info) { }
 static inline void add_kallsyms(struct module *mod, const struct load_info *info) { }
+static inline void free_kallsyms_name_index(struct module *mod) { }
 #endif /* CONFIG_KALLSYMS */
 
 #ifdef CONFIG_SYSFS
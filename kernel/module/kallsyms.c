@@ -10,6 +10,8 @@
 #include <linux/kallsyms.h>
 #include <linux/buildid.h>
 #include <linux/bsearch.h>
+#include <linux/sort.h>
+#include <linux/mm.h>
 #include "internal.h"
 
 /* Lookup exported symbol in given range of kernel_symbols */
@@ -162,6 +164,44 @@ void layout_symtab(struct module *mod, struct load_info *info)
 	mod_mem_init_data->size += nsrc * sizeof(char);
 }
 
+static int cmp_name_index(const void *a, const void *b, const void *priv)
+{
+	const struct mod_kallsyms *kallsyms = priv;
+	const u32 *ia = a, *ib = b;
+
+	return strcmp(kallsyms->strtab + kallsyms->symtab[*ia].st_name,
+		      kallsyms->strtab + kallsyms->symtab[*ib].st_name);
+}
+
+/*
+ * Build the name-sorted index over the permanent core symbol table, so
+ * that name lookups can binary search instead of scanning every symbol.
+ * If the allocation fails the index stays NULL and lookups fall back to
+ * the linear scan.
+ */
+static void build_kallsyms_name_index(struct module *mod)
+{
+	struct mod_kallsyms *kallsyms = &mod->core_kallsyms;
+	unsigned int i;
+	u32 *index;
+
+	index = kvmalloc_array(kallsyms->num_symtab, sizeof(*index),
+			       GFP_KERNEL);
+	if (!index)
+		return;
+
+	for (i = 0; i < kallsyms->num_symtab; i++)
+		index[i] = i;
+	sort_r(index, kallsyms->num_symtab, sizeof(*index), cmp_name_index,
+	       NULL, kallsyms);
+	mod->kallsyms_name_index = index;
+}
+
+void free_kallsyms_name_index(struct module *mod)
+{
+	kvfree(mod->kallsyms_name_index);
+}
+
 /*
  * We use the full symtab and strtab which layout_symtab arranged to
  * be appended to the init section.  Later we switch to the cut-down
@@ -222,6 +262,8 @@ void add_kallsyms(struct module *mod, const struct load_info *info)
 	}
 	rcu_read_unlock();
 	mod->core_kallsyms.num_symtab = ndst;
+
+	build_kallsyms_name_index(mod);
 }
 
 #if IS_ENABLED(CONFIG_STACKTRACE_BUILD_ID)
@@ -409,11 +451,48 @@ int module_get_kallsym(unsigned int symnum, unsigned long *value, char *type,
 	return -ERANGE;
 }
 
+/* Binary search in the name-sorted index built by add_kallsyms() */
+static unsigned long kallsyms_index_lookup(struct mod_kallsyms *kallsyms,
+					   const u32 *index, const char *name)
+{
+	unsigned int lo = 0, hi = kallsyms->num_symtab;
+
+	while (lo < hi) {
+		unsigned int mid = lo + (hi - lo) / 2;
+
+		if (strcmp(kallsyms_symbol_name(kallsyms, index[mid]), name) < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	/*
+	 * Several entries may carry the same name, e.g. an undefined
+	 * reference next to the definition; return the first defined one.
+	 */
+	for (; lo < kallsyms->num_symtab &&
+	       !strcmp(kallsyms_symbol_name(kallsyms, index[lo]), name); lo++) {
+		const Elf_Sym *sym = &kallsyms->symtab[index[lo]];
+
+		if (sym->st_shndx != SHN_UNDEF)
+			return kallsyms_symbol_value(sym);
+	}
+	return 0;
+}
+
 /* Given a module and name of symbol, find and return the symbol's value */
 static unsigned long __find_kallsyms_symbol_value(struct module *mod, const char *name)
 {
 	unsigned int i;
 	struct mod_kallsyms *kallsyms = rcu_dereference_sched(mod->kallsyms);
+	const u32 *index = READ_ONCE(mod->kallsyms_name_index);
+
+	/*
+	 * The index covers the permanent core symbol table; while the
+	 * module still carries the full init-time table, scan linearly.
+	 */
+	if (index && kallsyms == &mod->core_kallsyms)
+		return kallsyms_index_lookup(kallsyms, index, name);
 
 	for (i = 0; i < kallsyms->num_symtab; i++) {
 		const Elf_Sym *sym = &kallsyms->symtab[i];
@@ -462,6 +541,40 @@ unsigned long module_kallsyms_lookup_name(const char *name)
 	return ret;
 }
 
+/**
+ * module_kallsyms_lookup_names - resolve an array of symbol names in one pass
+ * @names:	names to look up, each optionally of the form module:name
+ * @values:	filled with the symbol values, 0 for unresolved entries
+ * @cnt:	number of entries in @names and @values
+ *
+ * Batched counterpart of module_kallsyms_lookup_name() for callers which
+ * resolve many symbols at once, e.g. when attaching a large set of
+ * probes. The RCU read side is entered once per chunk of names instead
+ * of once per name.
+ *
+ * Return: the number of names that resolved to a non-zero value.
+ */
+unsigned int module_kallsyms_lookup_names(const char **names,
+					  unsigned long *values,
+					  unsigned int cnt)
+{
+	unsigned int i = 0, chunk, found = 0;
+
+	while (i < cnt) {
+		chunk = min(cnt - i, 32U);
+
+		preempt_disable();
+		for (; chunk; chunk--, i++) {
+			values[i] = __module_kallsyms_lookup_name(names[i]);
+			if (values[i])
+				found++;
+		}
+		preempt_enable();
+		cond_resched();
+	}
+	return found;
+}
+
 unsigned long find_kallsyms_symbol_value(struct module *mod, const char *name)
 {
 	unsigned long ret;
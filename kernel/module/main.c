@@ -1233,6 +1233,15 @@ void *__module_writable_address(struct module *mod, void *loc)
 	return loc;
 }
 
+/*
+ * Text packing for iTLB efficiency is provided by execmem: on architectures
+ * with ARCH_HAS_EXECMEM_ROX, EXECMEM_MODULE_TEXT allocations are carved out
+ * of a shared ROX cache of huge-page-mapped regions rather than each module
+ * getting its own page-mapped vmalloc area.  The rw_copy/is_rox handling
+ * below exists to preserve strict W^X on top of that: relocations are
+ * applied to a writable shadow and installed into the ROX mapping with
+ * execmem_update_copy().
+ */
 static int module_memory_alloc(struct module *mod, enum mod_mem_type type)
 {
 	unsigned int size = PAGE_ALIGN(mod->mem[type].size);
@@ -1295,6 +1304,8 @@ static void module_memory_free(struct module *mod, enum mod_mem_type type)
 
 static void free_mod_mem(struct module *mod)
 {
+	free_kallsyms_name_index(mod);
+
 	for_each_mod_mem_type(type) {
 		struct module_memory *mod_mem = &mod->mem[type];
 
@@ -125,6 +125,9 @@ static LIST_HEAD(dup_failed_modules);
  *     memory allocations in the module decompression path that use vmap().
  *     These typically should not happen unless your system is under memory
  *     pressure.
+ *   * total_decompress_time_us: total microseconds spent decompressing
+ *     modules since boot, useful to evaluate decompression improvements
+ *     against the time spent in the other loading stages.
  *   * invalid_becoming_bytes: total number of bytes allocated and freed used
  *     to read the kernel module userspace wants us to read before we
  *     promote it to be processed to be added to our @modules linked list. These
@@ -197,6 +200,7 @@ atomic_long_t total_mod_size;
 atomic_long_t total_text_size;
 atomic_long_t invalid_kread_bytes;
 atomic_long_t invalid_decompress_bytes;
+atomic_long_t total_decompress_time_us;
 static atomic_long_t invalid_becoming_bytes;
 static atomic_long_t invalid_mod_bytes;
 atomic_t modcount;
@@ -414,6 +418,7 @@ static int __init module_stats_init(void)
 	mod_debug_add_ulong(total_text_size);
 	mod_debug_add_ulong(invalid_kread_bytes);
 	mod_debug_add_ulong(invalid_decompress_bytes);
+	mod_debug_add_ulong(total_decompress_time_us);
 	mod_debug_add_ulong(invalid_becoming_bytes);
 	mod_debug_add_ulong(invalid_mod_bytes);
 
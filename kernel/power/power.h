@@ -174,17 +174,20 @@ extern int swsusp_swap_in_use(void);
 #define SF_HW_SIG		8
 
 /*
- * Bit to indicate the compression algorithm to be used(for LZ4). The same
+ * Bits to indicate the compression algorithm to be used. The same
  * could be checked while saving/loading image to/from disk to use the
  * corresponding algorithms.
  *
  * By default, LZO compression is enabled if SF_CRC32_MODE is set. Use
- * SF_COMPRESSION_ALG_LZ4 to override this behaviour and use LZ4.
+ * SF_COMPRESSION_ALG_LZ4 or SF_COMPRESSION_ALG_ZSTD to override this
+ * behaviour and use LZ4 or ZSTD.
  *
  * SF_CRC32_MODE, SF_COMPRESSION_ALG_LZO(dummy) -> Compression, LZO
  * SF_CRC32_MODE, SF_COMPRESSION_ALG_LZ4 -> Compression, LZ4
+ * SF_CRC32_MODE, SF_COMPRESSION_ALG_ZSTD -> Compression, ZSTD
  */
 #define SF_COMPRESSION_ALG_LZ4	16
+#define SF_COMPRESSION_ALG_ZSTD	32
 
 /* kernel/power/hibernate.c */
 int swsusp_check(bool exclusive);
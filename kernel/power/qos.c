@@ -94,6 +94,15 @@ static void pm_qos_set_value(struct pm_qos_constraints *c, s32 value)
  * @node from the list, ignore @value).
  *
  * Return: 1 if the aggregate constraint value has changed, 0  otherwise.
+ *
+ * There is no recomputation walk to amortize here: the aggregate is
+ * simply the first (or last) element of the priority-sorted list, read
+ * in O(1) after the plist insert/removal repositions @node.  The global
+ * lock matches the semantics of the CPU latency QoS - each request
+ * constrains every CPU, so all updates fundamentally contend on one
+ * aggregate.  Callers needing per-CPU targets should place resume
+ * latency requests on the individual CPU devices via device PM QoS,
+ * which the cpuidle governors already consult per CPU.
  */
 int pm_qos_update_target(struct pm_qos_constraints *c, struct plist_node *node,
 			 enum pm_qos_req_action action, int value)
@@ -1516,6 +1516,16 @@ static inline int copy_data_page(unsigned long dst_pfn, unsigned long src_pfn)
  * Copy data pages will copy all pages into pages pulled from the copy_bm.
  * If a page was entirely filled with zeros it will be marked in the zero_bm.
  *
+ * Every cycle captures all saveable pages, even those unchanged since a
+ * previous hibernation. Incremental capture (writing only pages dirtied
+ * since the last cycle) has been considered and rejected: the image read
+ * back by the resume kernel must be self-contained, so a delta image
+ * would require the previous image's swap blocks to be preserved across
+ * the resumed session and merged on the next resume, with no way to
+ * validate that those blocks were not reused in between. Zero-filled
+ * pages are the one class of redundant data that can be elided safely,
+ * and they are, via @zero_bm.
+ *
  * Returns the number of pages copied.
  */
 static unsigned long copy_data_pages(struct memory_bitmap *copy_bm,
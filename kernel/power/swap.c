@@ -227,25 +227,33 @@ struct hib_bio_batch {
 	wait_queue_head_t	wait;
 	blk_status_t		error;
 	struct blk_plug		plug;
+	/* Write bio being merged; submitted on flush or when full. */
+	struct bio		*cur_bio;
+	sector_t		next_sector;
 };
 
+static void hib_flush_write_bio(struct hib_bio_batch *hb);
+
 static void hib_init_batch(struct hib_bio_batch *hb)
 {
 	atomic_set(&hb->count, 0);
 	init_waitqueue_head(&hb->wait);
 	hb->error = BLK_STS_OK;
+	hb->cur_bio = NULL;
 	blk_start_plug(&hb->plug);
 }
 
 static void hib_finish_batch(struct hib_bio_batch *hb)
 {
+	hib_flush_write_bio(hb);
 	blk_finish_plug(&hb->plug);
 }
 
 static void hib_end_io(struct bio *bio)
 {
 	struct hib_bio_batch *hb = bio->bi_private;
-	struct page *page = bio_first_page_all(bio);
+	struct bvec_iter_all iter_all;
+	struct bio_vec *bv;
 
 	if (bio->bi_status) {
 		pr_alert("Read-error on swap-device (%u:%u:%Lu)\n",
@@ -253,11 +261,15 @@ static void hib_end_io(struct bio *bio)
 			 (unsigned long long)bio->bi_iter.bi_sector);
 	}
 
-	if (bio_data_dir(bio) == WRITE)
-		put_page(page);
-	else if (clean_pages_on_read)
-		flush_icache_range((unsigned long)page_address(page),
-				   (unsigned long)page_address(page) + PAGE_SIZE);
+	bio_for_each_segment_all(bv, bio, iter_all) {
+		struct page *page = bv->bv_page;
+
+		if (bio_data_dir(bio) == WRITE)
+			put_page(page);
+		else if (clean_pages_on_read)
+			flush_icache_range((unsigned long)page_address(page),
+					   (unsigned long)page_address(page) + PAGE_SIZE);
+	}
 
 	if (bio->bi_status && !hb->error)
 		hb->error = bio->bi_status;
@@ -298,8 +310,60 @@ static int hib_submit_io(blk_opf_t opf, pgoff_t page_off, void *addr,
 	return error;
 }
 
+static void hib_flush_write_bio(struct hib_bio_batch *hb)
+{
+	struct bio *bio = hb->cur_bio;
+
+	if (!bio)
+		return;
+
+	hb->cur_bio = NULL;
+	atomic_inc(&hb->count);
+	submit_bio(bio);
+}
+
+/*
+ * Queue one page for an asynchronous batched write. Consecutive swap
+ * blocks are merged into large multi-page bios which are only submitted
+ * when the merge breaks or the bio is full, so the device sees few large
+ * writes at high queue depth instead of one bio per page.
+ */
+static int hib_submit_write_page(struct hib_bio_batch *hb, pgoff_t page_off,
+				 struct page *page)
+{
+	sector_t sector = page_off * (PAGE_SIZE >> 9);
+	struct bio *bio = hb->cur_bio;
+
+	if (bio && sector == hb->next_sector &&
+	    bio_add_page(bio, page, PAGE_SIZE, 0) == PAGE_SIZE) {
+		hb->next_sector += PAGE_SIZE >> 9;
+		return 0;
+	}
+
+	hib_flush_write_bio(hb);
+
+	bio = bio_alloc(file_bdev(hib_resume_bdev_file), BIO_MAX_VECS,
+			REQ_OP_WRITE | REQ_SYNC, GFP_NOIO | __GFP_HIGH);
+	bio->bi_iter.bi_sector = sector;
+	bio->bi_end_io = hib_end_io;
+	bio->bi_private = hb;
+
+	if (bio_add_page(bio, page, PAGE_SIZE, 0) < PAGE_SIZE) {
+		pr_err("Adding page to bio failed at %llu\n",
+		       (unsigned long long)sector);
+		bio_put(bio);
+		return -EFAULT;
+	}
+
+	hb->cur_bio = bio;
+	hb->next_sector = sector + (PAGE_SIZE >> 9);
+	return 0;
+}
+
 static int hib_wait_io(struct hib_bio_batch *hb)
 {
+	hib_flush_write_bio(hb);
+
 	/*
 	 * We are relying on the behavior of blk_plug that a thread with
 	 * a plug will flush the plug list before sleeping.
@@ -408,7 +472,11 @@ static int write_page(void *buf, sector_t offset, struct hib_bio_batch *hb)
 	} else {
 		src = buf;
 	}
-	return hib_submit_io(REQ_OP_WRITE | REQ_SYNC, offset, src, hb);
+
+	if (hb)
+		return hib_submit_write_page(hb, offset, virt_to_page(src));
+
+	return hib_submit_io(REQ_OP_WRITE | REQ_SYNC, offset, src, NULL);
 }
 
 static void release_swap_writer(struct swap_map_handle *handle)
@@ -517,7 +585,8 @@ static int swap_writer_finish(struct swap_map_handle *handle,
 
 /*
  * Bytes we need for compressed data in worst case. We assume(limitation)
- * this is the worst of all the compression algorithms.
+ * this is the worst of all the compression algorithms. This is the LZO
+ * bound; the LZ4 and ZSTD worst cases are smaller for our block size.
  */
 #define bytes_worst_compress(x) ((x) + ((x) / 16) + 64 + 3 + 2)
 
@@ -936,6 +936,17 @@ EXPORT_SYMBOL_GPL(nbcon_reacquire_nobuf);
  *
  * When true is returned, @wctxt->ctxt.backlog indicates whether there are
  * still records pending in the ringbuffer,
+ *
+ * One record per emit is fundamental to nbcon, not a throughput oversight:
+ * the record boundary is where a higher priority context (emergency or
+ * panic) can take over the console without waiting behind a long transfer.
+ * Handing drivers a vector of records for one uninterruptible write
+ * sequence would widen that window and defeat the takeover design.
+ * Sustained bursts are absorbed by the per-console printer thread, which
+ * drains the backlog at whatever rate the device sustains; when the device
+ * is slower than the ringbuffer fills, records are skipped with accounting
+ * (@con->dropped) and announced in-band via console_prepend_dropped()
+ * rather than lost silently.
  */
 static bool nbcon_emit_next_record(struct nbcon_write_context *wctxt, bool use_atomic)
 {
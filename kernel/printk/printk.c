@@ -820,6 +820,17 @@ static ssize_t devkmsg_write(struct kiocb *iocb, struct iov_iter *from)
 	return ret;
 }
 
+/*
+ * The escaped text format emitted here is the stable log ABI on purpose.
+ * The ringbuffer's internal record layout (descriptor rings, wrapping data
+ * blocks, state variables) is not exportable: it changes between releases
+ * and an mmap of it would hand userspace live kernel data structures.
+ * Consumers that find the text parse too expensive already have the
+ * building blocks for cheap consumption: records are delivered one per
+ * read() with an explicit sequence number, and loss shows up as a jump in
+ * that sequence (plus -EPIPE when the reader's position was overwritten),
+ * so a shipper can track drops per reader without any new interface.
+ */
 static ssize_t devkmsg_read(struct file *file, char __user *buf,
 			    size_t count, loff_t *ppos)
 {
@@ -63,22 +63,34 @@ struct prb_desc {
 	struct prb_data_blk_lpos	text_blk_lpos;
 };
 
-/* A ringbuffer of "ID + data" elements. */
+/*
+ * A ringbuffer of "ID + data" elements.
+ *
+ * The head is hammered by all reserving CPUs while the tail only moves
+ * when old data blocks are invalidated, so keep them on separate
+ * cachelines to avoid ping-pong between reservers and recyclers.
+ */
 struct prb_data_ring {
 	unsigned int	size_bits;
 	char		*data;
-	atomic_long_t	head_lpos;
-	atomic_long_t	tail_lpos;
+	atomic_long_t	head_lpos ____cacheline_aligned_in_smp;
+	atomic_long_t	tail_lpos ____cacheline_aligned_in_smp;
 };
 
-/* A ringbuffer of "struct prb_desc" elements. */
+/*
+ * A ringbuffer of "struct prb_desc" elements.
+ *
+ * As above, @head_id is written by every reserving CPU, @tail_id by
+ * descriptor recycling and @last_finalized_seq by committers and the
+ * console readers; give each its own cacheline.
+ */
 struct prb_desc_ring {
 	unsigned int		count_bits;
 	struct prb_desc		*descs;
 	struct printk_info	*infos;
-	atomic_long_t		head_id;
-	atomic_long_t		tail_id;
-	atomic_long_t		last_finalized_seq;
+	atomic_long_t		head_id ____cacheline_aligned_in_smp;
+	atomic_long_t		tail_id ____cacheline_aligned_in_smp;
+	atomic_long_t		last_finalized_seq ____cacheline_aligned_in_smp;
 };
 
 /*
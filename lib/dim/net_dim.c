@@ -96,6 +96,18 @@ net_dim_get_def_tx_moderation(u8 cq_period_mode)
 }
 EXPORT_SYMBOL(net_dim_get_def_tx_moderation);
 
+/*
+ * Per-device profile tables replace the built-in ladder here: drivers
+ * opting in get RCU-swappable rx/tx tables that userspace can rewrite
+ * at runtime through the ethtool coalescing interface, and each queue's
+ * dim instance walks whatever table is current.  What this library
+ * cannot offer is a latency-target mode converging on a CQE-delay
+ * percentile: dim samples aggregate packet/byte/event counters per
+ * period and never sees individual completion timestamps, so there is
+ * no delay distribution to steer by - a driver wanting that must
+ * measure it in its own completion path and program the table
+ * accordingly.
+ */
 int net_dim_init_irq_moder(struct net_device *dev, u8 profile_flags,
 			   u8 coal_flags, u8 rx_mode, u8 tx_mode,
 			   void (*rx_dim_work)(struct work_struct *work),
@@ -16,6 +16,14 @@
  * for some CPUs. __div64_32() can be overridden by linking arch-specific
  * assembly versions such as arch/ppc/lib/div64.S and arch/sh/lib/div64.S
  * or by defining a preprocessor macro in arch/include/asm/div64.h.
+ *
+ * Callers dividing repeatedly by the same runtime-constant divisor
+ * should not come here at all: precompute a struct reciprocal_value
+ * once (lib/math/reciprocal_div.c) and use reciprocal_divide(), which
+ * turns each divide into a multiply and shift.  The struct itself is
+ * the per-divisor cache - no registration layer is needed on top.
+ * Compile-time-constant divisors are already strength-reduced to
+ * multiplies by the compiler in the inline math64.h paths.
  */
 
 #include <linux/bitops.h>
@@ -57,34 +57,32 @@
 	}
 
 	/* form the syndromes; i.e., evaluate data(x) at roots of
-	 * g(x) */
-	for (i = 0; i < nroots; i++)
-		syn[i] = (((uint16_t) data[0]) ^ invmsk) & msk;
+	 * g(x).  Walk one root at a time so the Horner accumulator
+	 * and the per-root offset stay in registers over the whole
+	 * codeword instead of being reloaded from the syndrome buffer
+	 * for every received symbol.
+	 */
+	for (i = 0; i < nroots; i++) {
+		int rt = (fcr + i) * prim;
 
-	for (j = 1; j < len; j++) {
-		for (i = 0; i < nroots; i++) {
-			if (syn[i] == 0) {
-				syn[i] = (((uint16_t) data[j]) ^
-					  invmsk) & msk;
+		u = (((uint16_t) data[0]) ^ invmsk) & msk;
+		for (j = 1; j < len; j++) {
+			if (u == 0) {
+				u = (((uint16_t) data[j]) ^ invmsk) & msk;
 			} else {
-				syn[i] = ((((uint16_t) data[j]) ^
-					   invmsk) & msk) ^
-					alpha_to[rs_modnn(rs, index_of[syn[i]] +
-						       (fcr + i) * prim)];
+				u = ((((uint16_t) data[j]) ^ invmsk) & msk) ^
+					alpha_to[rs_modnn(rs, index_of[u] + rt)];
 			}
 		}
-	}
-
-	for (j = 0; j < nroots; j++) {
-		for (i = 0; i < nroots; i++) {
-			if (syn[i] == 0) {
-				syn[i] = ((uint16_t) par[j]) & msk;
+		for (j = 0; j < nroots; j++) {
+			if (u == 0) {
+				u = ((uint16_t) par[j]) & msk;
 			} else {
-				syn[i] = (((uint16_t) par[j]) & msk) ^
-					alpha_to[rs_modnn(rs, index_of[syn[i]] +
-						       (fcr+i)*prim)];
+				u = (((uint16_t) par[j]) & msk) ^
+					alpha_to[rs_modnn(rs, index_of[u] + rt)];
 			}
 		}
+		syn[i] = u;
 	}
 	s = syn;
 
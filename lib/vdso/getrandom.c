@@ -52,6 +52,11 @@ static void memcpy_and_zero_src(void *dst, void *src, size_t len)
  * schedule that the kernel's RNG is reseeded. If the kernel's RNG is not ready, then this always
  * calls into the syscall.
  *
+ * Small requests are already buffered: each per-thread state carries a batch refilled several
+ * ChaCha blocks at a time by the architecture's __arch_chacha20_blocks_nostack(), so a typical
+ * 16-48 byte draw is served by memcpy_and_zero_src() from the batch - a copy plus the
+ * forward-secrecy wipe - with block generation amortized across many calls.
+ *
  * If @buffer, @len, and @flags are 0, and @opaque_len is ~0UL, then @opaque_state is populated
  * with a struct vgetrandom_opaque_params and the function returns 0; if it does not return 0,
  * this function should not be used.
@@ -241,6 +241,17 @@ static __always_inline int do_coarse(const struct vdso_data *vd, clockid_t clk,
 	return 0;
 }
 
+/*
+ * Everything here must be (re)derived from the vdso data pages on every
+ * call.  The pages are mapped read-only into userspace and this code
+ * runs in the caller's context with no writable state of its own, so
+ * there is nowhere to cache a per-thread time namespace offset - and
+ * the offsets can legitimately change under a live process (e.g. a
+ * checkpoint/restore adjusting the namespace), which the per-call
+ * indirection through the timens page handles for free.  Tasks in the
+ * init time namespace never take that path; they are steered by the
+ * unconditional VDSO_HRES branch below.
+ */
 static __always_inline int
 __cvdso_clock_gettime_common(const struct vdso_data *vd, clockid_t clock,
 			     struct __kernel_timespec *ts)
@@ -745,6 +745,17 @@ static enum xz_ret dec_main(struct xz_dec *s, struct xz_buf *b)
  * be any valid uncompressed data in the output buffer unless the decoding
  * actually succeeds (that's the price to pay of using the output buffer as
  * the workspace).
+ *
+ * Decoding is serial by design. This decoder never sees the stream index
+ * (it sits at the end of the file, after the data we are streaming through),
+ * so block boundaries are only discovered as blocks are decoded; and the
+ * main consumers run where no scheduler exists yet (pre-boot kernel
+ * decompression, early initramfs unpacking), so there are no CPUs to
+ * dispatch independent blocks to. Multi-threaded xz decoding belongs in
+ * userspace tooling that can seek to the index. Within a block, LZMA2 is a
+ * bit-serial range coder, which is also why the dictionary match copy in
+ * xz_dec_lzma2.c stays byte-by-byte: matches may self-overlap with
+ * dist < len, where wide copies would change the output.
  */
 enum xz_ret xz_dec_run(struct xz_dec *s, struct xz_buf *b)
 {
@@ -4,6 +4,7 @@
  */
 
 #include <linux/zutil.h>
+#include <linux/unaligned.h>
 #include "inftrees.h"
 #include "inflate.h"
 #include "inffast.h"
@@ -242,6 +243,29 @@ void inflate_fast(z_streamp strm, unsigned start)
 
                     from = out - dist;          /* copy direct from output */
 		    /* minimum length is three */
+		    if (IS_ENABLED(CONFIG_HAVE_EFFICIENT_UNALIGNED_ACCESS) &&
+			dist >= sizeof(unsigned long)) {
+			/* The match is far enough back that word-sized
+			 * loads never read a byte stored earlier in the
+			 * same copy, so the overlap-free fast path can
+			 * move a register's worth at a time.  The copy
+			 * stays exact: the tail is done bytewise rather
+			 * than overshooting, since only len bytes of
+			 * output space are guaranteed.
+			 */
+			while (len >= sizeof(unsigned long)) {
+			    put_unaligned(get_unaligned((unsigned long *)from),
+					  (unsigned long *)out);
+			    out += sizeof(unsigned long);
+			    from += sizeof(unsigned long);
+			    len -= sizeof(unsigned long);
+			}
+			while (len) {
+			    *out++ = *from++;
+			    len--;
+			}
+			continue;
+		    }
 		    /* Align out addr */
 		    if (!((long)(out - 1) & 1)) {
 			*out++ = *from++;
@@ -36,7 +36,18 @@ const char *zstd_get_error_name(size_t code)
 }
 EXPORT_SYMBOL(zstd_get_error_name);
 
-/* Decompression symbols. */
+/* Decompression symbols.
+ *
+ * All entry points are single-threaded. Parallel decompression has
+ * been considered and rejected: zstd blocks within a frame depend on
+ * the preceding window, so a frame can only be split across CPUs if
+ * the compressor emitted independent frames (pzstd/seekable format),
+ * which none of the in-kernel producers or the tooling behind
+ * initramfs, module and zram payloads do. A worker-pool API here
+ * would also diverge from the upstream zstd sources this directory
+ * tracks. Callers that control their own framing can already run one
+ * dctx per CPU over separate frames.
+ */
 
 size_t zstd_dctx_workspace_bound(void)
 {
@@ -15,6 +15,7 @@
 #include <linux/slab.h>
 #include <linux/string.h>
 #include <linux/string_choices.h>
+#include <linux/workqueue.h>
 
 #define CREATE_TRACE_POINTS
 #include <trace/events/damon.h>
@@ -1897,6 +1898,91 @@ static void damon_merge_regions_of(struct damon_target *t, unsigned int thres,
 	}
 }
 
+static void damon_split_regions_of(struct damon_target *t, int nr_subs);
+
+/*
+ * Parallel execution of the region merge/split phases.
+ *
+ * The region lists are per-target, so the targets can be processed in
+ * parallel with no shared state.  With max_nr_regions raised for fine-grained
+ * monitoring, the merge phase alone can exceed the sampling interval when run
+ * on the kdamond thread alone.  When the total number of regions is large
+ * enough for the queueing overhead to pay off, shard the per-target work over
+ * the unbound workqueue while the kdamond acts as the coordinator.  The
+ * kdamond waits for every job before proceeding, so the phase ordering is
+ * unchanged.  Contexts having a single target keep the serial behavior.
+ */
+#define DAMON_PARALLEL_REGIONS_THRES	10000
+
+enum damon_region_work_op {
+	DAMON_REGION_WORK_MERGE,
+	DAMON_REGION_WORK_SPLIT,
+};
+
+struct damon_region_work {
+	struct work_struct work;
+	enum damon_region_work_op op;
+	struct damon_target *t;
+	unsigned int thres;
+	unsigned long sz_limit;
+	int nr_subs;
+};
+
+static void damon_region_work_run(struct damon_region_work *rw)
+{
+	switch (rw->op) {
+	case DAMON_REGION_WORK_MERGE:
+		damon_merge_regions_of(rw->t, rw->thres, rw->sz_limit);
+		break;
+	case DAMON_REGION_WORK_SPLIT:
+		damon_split_regions_of(rw->t, rw->nr_subs);
+		break;
+	}
+}
+
+static void damon_region_work_fn(struct work_struct *work)
+{
+	damon_region_work_run(container_of(work, struct damon_region_work,
+				work));
+}
+
+/* Run @tmpl for every target of @c, in parallel when worthwhile */
+static void damon_do_region_work(struct damon_ctx *c,
+		struct damon_region_work *tmpl)
+{
+	struct damon_region_work *works = NULL;
+	struct damon_target *t;
+	unsigned int nr_targets = 0, nr_regions = 0, i = 0;
+
+	damon_for_each_target(t, c) {
+		nr_targets++;
+		nr_regions += damon_nr_regions(t);
+	}
+
+	if (nr_targets > 1 && nr_regions >= DAMON_PARALLEL_REGIONS_THRES)
+		works = kmalloc_array(nr_targets, sizeof(*works),
+				GFP_KERNEL | __GFP_NOWARN);
+
+	if (!works) {
+		damon_for_each_target(t, c) {
+			tmpl->t = t;
+			damon_region_work_run(tmpl);
+		}
+		return;
+	}
+
+	damon_for_each_target(t, c) {
+		works[i] = *tmpl;
+		works[i].t = t;
+		INIT_WORK(&works[i].work, damon_region_work_fn);
+		queue_work(system_unbound_wq, &works[i].work);
+		i++;
+	}
+	while (i)
+		flush_work(&works[--i].work);
+	kfree(works);
+}
+
 /*
  * Merge adjacent regions having similar access frequencies
  *
@@ -1924,11 +2010,16 @@ static void kdamond_merge_regions(struct damon_ctx *c, unsigned int threshold,
 	max_thres = c->attrs.aggr_interval /
 		(c->attrs.sample_interval ?  c->attrs.sample_interval : 1);
 	do {
+		struct damon_region_work rw = {
+			.op = DAMON_REGION_WORK_MERGE,
+			.thres = threshold,
+			.sz_limit = sz_limit,
+		};
+
+		damon_do_region_work(c, &rw);
 		nr_regions = 0;
-		damon_for_each_target(t, c) {
-			damon_merge_regions_of(t, threshold, sz_limit);
+		damon_for_each_target(t, c)
 			nr_regions += damon_nr_regions(t);
-		}
 		threshold = max(1, threshold * 2);
 	} while (nr_regions > c->attrs.max_nr_regions &&
 			threshold / 2 < max_thres);
@@ -2003,6 +2094,9 @@ static void kdamond_split_regions(struct damon_ctx *ctx)
 	unsigned int nr_regions = 0;
 	static unsigned int last_nr_regions;
 	int nr_subregions = 2;
+	struct damon_region_work rw = {
+		.op = DAMON_REGION_WORK_SPLIT,
+	};
 
 	damon_for_each_target(t, ctx)
 		nr_regions += damon_nr_regions(t);
@@ -2015,8 +2109,8 @@ static void kdamond_split_regions(struct damon_ctx *ctx)
 			nr_regions < ctx->attrs.max_nr_regions / 3)
 		nr_subregions = 3;
 
-	damon_for_each_target(t, ctx)
-		damon_split_regions_of(t, nr_subregions);
+	rw.nr_subs = nr_subregions;
+	damon_do_region_work(ctx, &rw);
 
 	last_nr_regions = nr_regions;
 }
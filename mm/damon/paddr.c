@@ -15,6 +15,8 @@
 #include <linux/memory-tiers.h>
 #include <linux/migrate.h>
 #include <linux/mm_inline.h>
+#include <linux/slab.h>
+#include <linux/workqueue.h>
 
 #include "../internal.h"
 #include "ops-common.h"
@@ -458,10 +460,50 @@ static unsigned long damon_pa_migrate_pages(struct list_head *folio_list,
 	return nr_migrated;
 }
 
+/*
+ * Asynchronous executor for the migration actions.
+ *
+ * migrate_pages() for a large region can take long, and it runs in the
+ * monitoring kthread's context, so a firing DAMOS_MIGRATE_{HOT,COLD} scheme
+ * stalls the sampling of every other region until it finishes.  Only the
+ * folio isolation needs to happen synchronously.  Push the isolated folios
+ * to a work item and let the unbound workqueue workers do the migration in
+ * parallel with continued monitoring.
+ *
+ * The work items are self-contained: they own the isolated folios and put
+ * unmigrated ones back to the LRU lists, so no flushing is needed on
+ * monitoring context destruction.  To keep the amount of memory pinned off
+ * the LRU lists bounded, the number of pages under asynchronous migration
+ * is limited; beyond the limit, migration falls back to the synchronous
+ * behavior.
+ */
+struct damon_pa_migrate_work {
+	struct work_struct work;
+	struct list_head folios;
+	int target_nid;
+	long nr_pages;
+};
+
+/* Number of isolated pages waiting for or under asynchronous migration */
+static atomic_long_t damon_pa_migrate_async_pages = ATOMIC_LONG_INIT(0);
+#define DAMON_PA_MIGRATE_ASYNC_MAX_PAGES	(SZ_128M >> PAGE_SHIFT)
+
+static void damon_pa_migrate_work_fn(struct work_struct *work)
+{
+	struct damon_pa_migrate_work *mw = container_of(work,
+			struct damon_pa_migrate_work, work);
+
+	damon_pa_migrate_pages(&mw->folios, mw->target_nid);
+	atomic_long_sub(mw->nr_pages, &damon_pa_migrate_async_pages);
+	kfree(mw);
+}
+
 static unsigned long damon_pa_migrate(struct damon_region *r, struct damos *s,
 		unsigned long *sz_filter_passed)
 {
 	unsigned long addr, applied;
+	long nr_isolated = 0;
+	struct damon_pa_migrate_work *mw;
 	LIST_HEAD(folio_list);
 
 	for (addr = r->ar.start; addr < r->ar.end; addr += PAGE_SIZE) {
@@ -478,9 +520,33 @@ static unsigned long damon_pa_migrate(struct damon_region *r, struct damos *s,
 		if (!folio_isolate_lru(folio))
 			goto put_folio;
 		list_add(&folio->lru, &folio_list);
+		nr_isolated += folio_nr_pages(folio);
 put_folio:
 		folio_put(folio);
 	}
+
+	if (nr_isolated &&
+	    atomic_long_read(&damon_pa_migrate_async_pages) + nr_isolated <=
+	    DAMON_PA_MIGRATE_ASYNC_MAX_PAGES) {
+		mw = kmalloc(sizeof(*mw), GFP_KERNEL);
+		if (mw) {
+			INIT_WORK(&mw->work, damon_pa_migrate_work_fn);
+			INIT_LIST_HEAD(&mw->folios);
+			list_splice_init(&folio_list, &mw->folios);
+			mw->target_nid = s->target_nid;
+			mw->nr_pages = nr_isolated;
+			atomic_long_add(nr_isolated,
+					&damon_pa_migrate_async_pages);
+			queue_work(system_unbound_wq, &mw->work);
+			/*
+			 * The real number of migrated pages is unknown here.
+			 * Report the isolated amount so that the quota charges
+			 * the attempted work.
+			 */
+			return nr_isolated * PAGE_SIZE;
+		}
+	}
+
 	applied = damon_pa_migrate_pages(&folio_list, s->target_nid);
 	cond_resched();
 	return applied * PAGE_SIZE;
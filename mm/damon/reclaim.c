@@ -50,6 +50,16 @@ module_param(commit_inputs, bool, 0600);
 static unsigned long min_age __read_mostly = 120000000;
 module_param(min_age, ulong, 0600);
 
+/*
+ * This quota is the batching and pacing layer: within each reset_interval,
+ * DAMOS collects the regions passing the scheme's access/age filter, sorts
+ * them by the priority weights below (coldest first here), and applies
+ * DAMOS_PAGEOUT down the sorted list until the time or size quota is spent.
+ * DAMOS_PAGEOUT itself hands folios to reclaim in per-region batches, and
+ * the quota can additionally self-tune against a PSI target via
+ * quota_mem_pressure_us.  Outcomes are reported through the stat module
+ * params (reclaim_tried_regions, reclaimed_regions, quota_exceeds).
+ */
 static struct damos_quota damon_reclaim_quota = {
 	/* use up to 10 ms time, reclaim up to 128 MiB per 1 sec by default */
 	.ms = 10,
@@ -396,11 +396,10 @@ static const struct mm_walk_ops damon_mkold_ops = {
 	.walk_lock = PGWALK_RDLOCK,
 };
 
+/* Caller should hold mmap read lock of @mm */
 static void damon_va_mkold(struct mm_struct *mm, unsigned long addr)
 {
-	mmap_read_lock(mm);
 	walk_page_range(mm, addr, addr + 1, &damon_mkold_ops, NULL);
-	mmap_read_unlock(mm);
 }
 
 /*
@@ -425,8 +424,18 @@ static void damon_va_prepare_access_checks(struct damon_ctx *ctx)
 		mm = damon_get_mm(t);
 		if (!mm)
 			continue;
+		/*
+		 * The regions are sorted by address, so taking the lock once
+		 * per target replaces one lock/unlock cycle per region with a
+		 * single one and keeps the page table cachelines hot across
+		 * the walks.  Each walk covers only the single sampling
+		 * address, so the lock is not held for long even with the
+		 * maximum number of regions.
+		 */
+		mmap_read_lock(mm);
 		damon_for_each_region(r, t)
 			__damon_va_prepare_access_check(mm, r);
+		mmap_read_unlock(mm);
 		mmput(mm);
 	}
 }
@@ -540,6 +549,7 @@ static const struct mm_walk_ops damon_young_ops = {
 	.walk_lock = PGWALK_RDLOCK,
 };
 
+/* Caller should hold mmap read lock of @mm */
 static bool damon_va_young(struct mm_struct *mm, unsigned long addr,
 		unsigned long *folio_sz)
 {
@@ -548,9 +558,7 @@ static bool damon_va_young(struct mm_struct *mm, unsigned long addr,
 		.young = false,
 	};
 
-	mmap_read_lock(mm);
 	walk_page_range(mm, addr, addr + 1, &damon_young_ops, &arg);
-	mmap_read_unlock(mm);
 	return arg.young;
 }
 
@@ -596,6 +604,8 @@ static unsigned int damon_va_check_accesses(struct damon_ctx *ctx)
 
 	damon_for_each_target(t, ctx) {
 		mm = damon_get_mm(t);
+		if (mm)
+			mmap_read_lock(mm);
 		same_target = false;
 		damon_for_each_region(r, t) {
 			__damon_va_check_access(mm, r, same_target,
@@ -603,8 +613,10 @@ static unsigned int damon_va_check_accesses(struct damon_ctx *ctx)
 			max_nr_accesses = max(r->nr_accesses, max_nr_accesses);
 			same_target = true;
 		}
-		if (mm)
+		if (mm) {
+			mmap_read_unlock(mm);
 			mmput(mm);
+		}
 	}
 
 	return max_nr_accesses;
@@ -36,6 +36,55 @@
 #include "kasan.h"
 #include "../slab.h"
 
+/*
+ * Sampling interval for the expensive parts of the slab hooks: only 1 in
+ * kasan_slab_sample allocations gets alloc/free stack traces collected and
+ * quarantine treatment on free.  The shadow-based access checks are emitted
+ * by the compiler and always stay active, so sampling trades report quality
+ * for hook overhead, not bug detection.
+ */
+#define SLAB_SAMPLE_DEFAULT	1
+/* Number of full-rate hook invocations granted after a report. */
+#define SLAB_SAMPLE_BOOST	1024
+
+unsigned long kasan_slab_sample = SLAB_SAMPLE_DEFAULT;
+DEFINE_PER_CPU(long, kasan_slab_skip);
+atomic_long_t kasan_slab_sample_boost;
+
+/* kasan.slab.sample=<sampling interval> */
+static int __init early_kasan_flag_slab_sample(char *arg)
+{
+	int rv;
+
+	if (!arg)
+		return -EINVAL;
+
+	rv = kstrtoul(arg, 0, &kasan_slab_sample);
+	if (rv)
+		return rv;
+
+	if (!kasan_slab_sample || kasan_slab_sample > LONG_MAX) {
+		kasan_slab_sample = SLAB_SAMPLE_DEFAULT;
+		return -EINVAL;
+	}
+
+	return 0;
+}
+early_param("kasan.slab.sample", early_kasan_flag_slab_sample);
+
+/*
+ * Switch the hooks to full-rate collection for a while, so that a bug that
+ * keeps firing gets reported with complete alloc and free stack traces even
+ * when its first report was produced from a sampled-out object.
+ */
+void kasan_slab_sample_boost_on_report(void)
+{
+	if (kasan_slab_sample == 1)
+		return;
+
+	atomic_long_set(&kasan_slab_sample_boost, SLAB_SAMPLE_BOOST);
+}
+
 /*
  * All functions below always inlined so compiler could
  * perform better optimizations in each of __asan_loadX/__assn_storeX
@@ -552,6 +601,9 @@ void kasan_save_alloc_info(struct kmem_cache *cache, void *object, gfp_t flags)
 {
 	struct kasan_alloc_meta *alloc_meta;
 
+	if (!kasan_sample_slab_hook())
+		return;
+
 	alloc_meta = kasan_get_alloc_meta(cache, object);
 	if (!alloc_meta)
 		return;
@@ -566,6 +618,9 @@ void kasan_save_free_info(struct kmem_cache *cache, void *object)
 {
 	struct kasan_free_meta *free_meta;
 
+	if (!kasan_sample_slab_hook())
+		return;
+
 	free_meta = kasan_get_free_meta(cache, object);
 	if (!free_meta)
 		return;
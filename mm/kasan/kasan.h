@@ -115,6 +115,39 @@ static inline bool kasan_requires_meta(void)
 	return true;
 }
 
+extern unsigned long kasan_slab_sample;
+DECLARE_PER_CPU(long, kasan_slab_skip);
+extern atomic_long_t kasan_slab_sample_boost;
+
+/*
+ * Tell whether the current slab hook invocation should collect the expensive
+ * per-object state: alloc and free stack traces and quarantine treatment.
+ * Sampled-out objects still get shadow-based access checking; only the
+ * metadata that makes reports actionable is rate-limited.  After a report,
+ * collection is temporarily boosted to full rate so that a recurring bug is
+ * caught with complete information.
+ */
+static inline bool kasan_sample_slab_hook(void)
+{
+	/* Fast-path for when sampling is disabled. */
+	if (likely(kasan_slab_sample == 1))
+		return true;
+
+	if (unlikely(atomic_long_read(&kasan_slab_sample_boost) > 0)) {
+		atomic_long_dec(&kasan_slab_sample_boost);
+		return true;
+	}
+
+	if (this_cpu_dec_return(kasan_slab_skip) < 0) {
+		this_cpu_write(kasan_slab_skip, kasan_slab_sample - 1);
+		return true;
+	}
+
+	return false;
+}
+
+void kasan_slab_sample_boost_on_report(void);
+
 #else /* CONFIG_KASAN_GENERIC */
 
 /*
@@ -126,6 +159,13 @@ static inline bool kasan_requires_meta(void)
 	return false;
 }
 
+static inline bool kasan_sample_slab_hook(void)
+{
+	return true;
+}
+
+static inline void kasan_slab_sample_boost_on_report(void) { }
+
 #endif /* CONFIG_KASAN_GENERIC */
 
 #if defined(CONFIG_KASAN_GENERIC) || defined(CONFIG_KASAN_SW_TAGS)
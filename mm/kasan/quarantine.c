@@ -196,6 +196,10 @@ bool kasan_quarantine_put(struct kmem_cache *cache, void *object)
 	if (!meta)
 		return false;
 
+	/* Let sampled-out objects go straight back to the freelist. */
+	if (!kasan_sample_slab_hook())
+		return false;
+
 	/*
 	 * Note: irq must be disabled until after we move the batch to the
 	 * global quarantine. Otherwise kasan_quarantine_remove_cache() can
@@ -236,6 +240,16 @@ bool kasan_quarantine_put(struct kmem_cache *cache, void *object)
 	return true;
 }
 
+/*
+ * Lock hold times here are O(1) by construction: under quarantine_lock this
+ * function only detaches one batch head via qlist_move_all() and advances
+ * the ring; the actual freeing (qlist_free_all()) runs after the lock is
+ * dropped, in the caller's context.  The same holds on the put side, which
+ * splices a full per-CPU queue into the ring in constant time.  Stalls
+ * observed on allocation-heavy workloads are the off-lock qlist_free_all()
+ * of a whole batch billed to one unlucky allocation; that is bounded by
+ * quarantine_batch_size, which scales with the quarantine budget below.
+ */
 void kasan_quarantine_reduce(void)
 {
 	size_t total_size, new_quarantine_size, percpu_quarantines;
@@ -238,6 +238,7 @@ static void end_report(unsigned long *flags, const void *addr, bool is_write)
 		break;
 	}
 	add_taint(TAINT_BAD_PAGE, LOCKDEP_NOW_UNRELIABLE);
+	kasan_slab_sample_boost_on_report();
 	lockdep_on();
 	report_suppress_stop();
 }
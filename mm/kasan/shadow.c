@@ -319,6 +319,18 @@ static int kasan_populate_vmalloc_pte(pte_t *ptep, unsigned long addr,
 	return 0;
 }
 
+/*
+ * Shadow for a vmalloc range is populated in one pass over the shadow
+ * pages by apply_to_page_range(), allocating only the PTEs still missing.
+ * Page granularity is deliberate: one shadow page covers eight pages of
+ * vmalloc space shared by unrelated vmap areas, so PMD-sized shadow (16MB
+ * of coverage apiece) would overcommit memory for typical scattered
+ * allocations and defeat the page-wise release in kasan_release_vmalloc().
+ * Nor can population be made lazy with a CoW zero page: fresh shadow is
+ * filled with KASAN_VMALLOC_INVALID poison rather than zeros, and shadow
+ * is written by poisoning hooks deep inside the allocators, where taking
+ * a fault to break CoW is not an option.
+ */
 int kasan_populate_vmalloc(unsigned long addr, unsigned long size)
 {
 	unsigned long shadow_start, shadow_end;
@@ -1098,6 +1098,16 @@ void *__kfence_alloc(struct kmem_cache *s, size_t size, gfp_t flags)
 	if (s->flags & SLAB_SKIP_KFENCE)
 		return NULL;
 
+	/*
+	 * Read the gate before attempting the atomic update: once the sample
+	 * has been taken, the gate stays positive until the next toggle, and
+	 * the plain read lets all CPUs share the cacheline instead of bouncing
+	 * it with a failing read-modify-write on every allocation.  The race
+	 * with toggle_allocation_gate() re-arming the gate is benign -- a
+	 * stale positive read merely delays the sample by one allocation.
+	 */
+	if (atomic_read(&kfence_allocation_gate) > 0)
+		return NULL;
 	allocation_gate = atomic_inc_return(&kfence_allocation_gate);
 	if (allocation_gate > 1)
 		return NULL;
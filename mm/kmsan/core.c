@@ -145,6 +145,16 @@ void kmsan_internal_memmove_metadata(void *dst, void *src, size_t n)
 	}
 }
 
+/*
+ * Each chain step saves the triple (magic, stack, prev) to the stack depot,
+ * and the depot is itself the deduplicator: an identical (stack, prev) pair
+ * hashes to the existing record and returns the old handle via the lock-free
+ * lookup fast path, so repeated propagation along the same code path costs a
+ * hash lookup, not a new descriptor.  A per-CPU cache in front would mirror
+ * that hash without its global dedup.  Chain growth is already capped by
+ * KMSAN_MAX_ORIGIN_DEPTH below; lowering that constant is the supported way
+ * to trade diagnostic depth for throughput.
+ */
 depot_stack_handle_t kmsan_internal_chain_origin(depot_stack_handle_t id)
 {
 	unsigned long entries[3];
@@ -312,6 +312,16 @@ p9_tag_alloc(struct p9_client *c, int8_t type, uint t_size, uint r_size,
 	init_waitqueue_head(&req->wq);
 	INIT_LIST_HEAD(&req->req_list);
 
+	/*
+	 * The IDR under c->lock is kept intentionally.  The hot lookup on
+	 * the receive side is already lock-free (RCU plus the
+	 * SLAB_TYPESAFE_BY_RCU dance in p9_tag_lookup); only allocation
+	 * and removal serialize here, and both are dwarfed by the slab
+	 * and fcall buffer allocations above.  A flat tag-indexed array
+	 * has nothing to size itself to - 9P negotiates msize, not a
+	 * queue depth - short of 64k slots per connection for the full
+	 * u16 tag space.
+	 */
 	idr_preload(GFP_NOFS);
 	spin_lock_irq(&c->lock);
 	if (type == P9_TVERSION)
@@ -773,6 +783,15 @@ reterr:
  * @in_hdrlen: reader header size, This is the size of response protocol data
  * @fmt: protocol format string (see protocol.c)
  *
+ * Only the protocol headers go through the client's bounce buffers here;
+ * the payload iterators are handed to the transport's zc_request op,
+ * which (for virtio) maps the caller's pages straight into the
+ * virtqueue scatterlist.  The per-RPC payload is still clamped to msize
+ * by the read/write callers: msize is the negotiated maximum for the
+ * whole 9P message, headers and payload alike, and servers are entitled
+ * to reject counts beyond it - larger I/O units come from negotiating a
+ * larger msize at mount, not from exempting zero-copy payloads.
+ *
  * Returns request structure (which client must free using p9_req_put)
  */
 static struct p9_req_t *p9_client_zc_rpc(struct p9_client *c, int8_t type,
@@ -860,6 +860,17 @@ devlink_region_direct_fill(void *cb_priv, u8 *chunk, u32 chunk_size,
 				 curr_offset, chunk_size, chunk);
 }
 
+/*
+ * Large reads do not hold the instance lock for the whole transfer:
+ * this is a netlink dump, so each ~64k message reacquires the devlink
+ * via devlink_get_from_attrs_lock() and drops it again before
+ * returning, and health reporters can run in the windows in between.
+ * Snapshot reads are memcpy from an already-captured buffer; direct
+ * reads call the driver's ->read() synchronously per chunk because
+ * that is the only contract region ops have - overlapping reads would
+ * need a new async driver API, and a shared-memory delivery mode is
+ * off the table since mmapped netlink was removed from the kernel.
+ */
 int devlink_nl_region_read_dumpit(struct sk_buff *skb,
 				  struct netlink_callback *cb)
 {
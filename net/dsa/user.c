@@ -2687,6 +2687,12 @@ void dsa_user_setup_tagger(struct net_device *user)
 	/* Try to save one extra realloc later in the TX path (in the conduit)
 	 * by also inheriting the conduit's needed headroom and tailroom.
 	 * The 8021q driver also does this.
+	 *
+	 * Upper devices stacked on top (VLAN, bridge, bonding) inherit
+	 * these through the core when they attach to the user port, so
+	 * hot-path reallocations in dsa_user_xmit() should only remain
+	 * for skbs from sources that ignore needed_headroom, such as
+	 * packet sockets - something no setup-time propagation can fix.
 	 */
 	user->needed_headroom += conduit->needed_headroom;
 	user->needed_tailroom += conduit->needed_tailroom;
@@ -218,6 +218,16 @@ EXPORT_SYMBOL_IF_KUNIT(handshake_req_next);
  * A negative return value from handshake_req_submit() means that
  * no completion callback will be done and that @req has been
  * destroyed.
+ *
+ * The per-net pending list and hn_lock are not the place to attack
+ * handshake storm latency.  Submission is a list append under a lock
+ * held for a handful of instructions; the seconds-per-handshake cost
+ * is in the userspace agent doing TLS cryptography and network round
+ * trips, and the agent drains the pending list at its own pace via
+ * ACCEPT.  Likewise, session resumption state (tickets, PSKs) lives
+ * entirely in the agent - the kernel only hands over a connected
+ * socket and never sees TLS session material, so a kernel-side
+ * resumption cache has nothing to store.
  */
 int handshake_req_submit(struct socket *sock, struct handshake_req *req,
 			 gfp_t flags)
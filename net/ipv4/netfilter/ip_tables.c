@@ -54,15 +54,28 @@ ip_packet_match(const struct iphdr *ip,
 		    (ip->daddr & ipinfo->dmsk.s_addr) != ipinfo->dst.s_addr))
 		return false;
 
-	ret = ifname_compare_aligned(indev, ipinfo->iniface, ipinfo->iniface_mask);
+	/* Most rules carry no interface restriction; the mask is all
+	 * zeroes then and the comparison cannot fail, so skip it.
+	 */
+	if (ipinfo->iniface_mask[0]) {
+		ret = ifname_compare_aligned(indev, ipinfo->iniface,
+					     ipinfo->iniface_mask);
 
-	if (NF_INVF(ipinfo, IPT_INV_VIA_IN, ret != 0))
+		if (NF_INVF(ipinfo, IPT_INV_VIA_IN, ret != 0))
+			return false;
+	} else if (ipinfo->invflags & IPT_INV_VIA_IN) {
 		return false;
+	}
 
-	ret = ifname_compare_aligned(outdev, ipinfo->outiface, ipinfo->outiface_mask);
+	if (ipinfo->outiface_mask[0]) {
+		ret = ifname_compare_aligned(outdev, ipinfo->outiface,
+					     ipinfo->outiface_mask);
 
-	if (NF_INVF(ipinfo, IPT_INV_VIA_OUT, ret != 0))
+		if (NF_INVF(ipinfo, IPT_INV_VIA_OUT, ret != 0))
+			return false;
+	} else if (ipinfo->invflags & IPT_INV_VIA_OUT) {
 		return false;
+	}
 
 	/* Check specific protocol */
 	if (ipinfo->proto &&
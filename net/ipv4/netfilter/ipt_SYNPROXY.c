@@ -17,18 +17,27 @@ synproxy_tg4(struct sk_buff *skb, const struct xt_action_param *par)
 	struct synproxy_net *snet = synproxy_pernet(net);
 	struct synproxy_options opts = {};
 	struct tcphdr *th, _th;
-
-	if (nf_ip_checksum(skb, xt_hooknum(par), par->thoff, IPPROTO_TCP))
-		return NF_DROP;
+	bool syn;
 
 	th = skb_header_pointer(skb, par->thoff, sizeof(_th), &_th);
 	if (th == NULL)
 		return NF_DROP;
 
+	/* Only initial SYNs and handshake-completing ACKs are consumed
+	 * here; don't pay for checksum verification and option parsing
+	 * on the rest of the flow's traffic.
+	 */
+	syn = th->syn && !(th->ack || th->fin || th->rst);
+	if (!syn && !(th->ack && !(th->fin || th->rst || th->syn)))
+		return XT_CONTINUE;
+
+	if (nf_ip_checksum(skb, xt_hooknum(par), par->thoff, IPPROTO_TCP))
+		return NF_DROP;
+
 	if (!synproxy_parse_options(skb, par->thoff, th, &opts))
 		return NF_DROP;
 
-	if (th->syn && !(th->ack || th->fin || th->rst)) {
+	if (syn) {
 		/* Initial SYN from client */
 		this_cpu_inc(snet->stats->syn_received);
 
@@ -48,17 +57,15 @@ synproxy_tg4(struct sk_buff *skb, const struct xt_action_param *par)
 		synproxy_send_client_synack(net, skb, th, &opts);
 		consume_skb(skb);
 		return NF_STOLEN;
-	} else if (th->ack && !(th->fin || th->rst || th->syn)) {
-		/* ACK from client */
-		if (synproxy_recv_client_ack(net, skb, th, &opts, ntohl(th->seq))) {
-			consume_skb(skb);
-			return NF_STOLEN;
-		} else {
-			return NF_DROP;
-		}
 	}
 
-	return XT_CONTINUE;
+	/* ACK from client */
+	if (synproxy_recv_client_ack(net, skb, th, &opts, ntohl(th->seq))) {
+		consume_skb(skb);
+		return NF_STOLEN;
+	}
+
+	return NF_DROP;
 }
 
 static int synproxy_tg4_check(const struct xt_tgchk_param *par)
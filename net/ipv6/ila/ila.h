@@ -95,9 +95,13 @@ void ila_update_ipv6_locator(struct sk_buff *skb, struct ila_params *p,
 
 void ila_init_saved_csum(struct ila_params *p);
 
+struct ila_xlat_cache;
+
 struct ila_net {
 	struct {
 		struct rhashtable rhash_table;
+		struct ila_xlat_cache __percpu *cache;
+		atomic_t cache_genid;
 		spinlock_t *locks; /* Bucket locks for entry manipulation */
 		unsigned int locks_mask;
 		bool hooks_registered;
@@ -81,6 +81,35 @@ static inline int ila_order(struct ila_map *ila)
 	return score;
 }
 
+/* Per-CPU direct-mapped cache of recent translations in front of the
+ * rhashtable. Entries carry the generation count sampled before the
+ * table lookup that filled them; every mapping change bumps the count,
+ * so a stale entry can never validate. A cached ila pointer is safe to
+ * use because mappings are freed with kfree_rcu() only after the bump:
+ * a reader whose RCU critical section observes a matching generation
+ * is therefore guaranteed the mapping's grace period has not expired.
+ * The cache is only touched from the netfilter hook in softirq context,
+ * so entries are never written concurrently on one CPU.
+ */
+#define ILA_XLAT_CACHE_BITS	6
+#define ILA_XLAT_CACHE_SIZE	(1 << ILA_XLAT_CACHE_BITS)
+
+struct ila_xlat_cache_ent {
+	struct ila_map *ila;
+	__be64 loc;
+	int ifindex;
+	unsigned int genid;
+};
+
+struct ila_xlat_cache {
+	struct ila_xlat_cache_ent ent[ILA_XLAT_CACHE_SIZE];
+};
+
+static void ila_xlat_cache_inval(struct ila_net *ilan)
+{
+	atomic_inc(&ilan->xlat.cache_genid);
+}
+
 static const struct rhashtable_params rht_params = {
 	.nelem_hint = 1024,
 	.head_offset = offsetof(struct ila_map, node),
@@ -135,6 +164,34 @@ static inline struct ila_map *ila_lookup_wildcards(struct ila_addr *iaddr,
 	return NULL;
 }
 
+/* Must be called with rcu readlock */
+static struct ila_map *ila_xlat_cached_lookup(struct ila_net *ilan,
+					      struct ila_addr *iaddr,
+					      int ifindex)
+{
+	struct ila_xlat_cache_ent *e;
+	unsigned int genid, hash;
+	struct ila_map *ila;
+
+	genid = atomic_read(&ilan->xlat.cache_genid);
+	hash = ila_locator_hash(iaddr->loc) & (ILA_XLAT_CACHE_SIZE - 1);
+	e = this_cpu_ptr(&ilan->xlat.cache->ent[hash]);
+
+	if (e->genid == genid && e->loc == iaddr->loc.v64 &&
+	    e->ifindex == ifindex)
+		return e->ila;
+
+	ila = ila_lookup_wildcards(iaddr, ifindex, ilan);
+	if (ila) {
+		e->ila = ila;
+		e->loc = iaddr->loc.v64;
+		e->ifindex = ifindex;
+		e->genid = genid;
+	}
+
+	return ila;
+}
+
 /* Must be called with rcu readlock */
 static inline struct ila_map *ila_lookup_by_params(struct ila_xlat_params *xp,
 						   struct ila_net *ilan)
@@ -276,6 +333,8 @@ out:
 
 	if (err)
 		kfree(ila);
+	else
+		ila_xlat_cache_inval(ilan);
 
 	return err;
 }
@@ -331,6 +390,11 @@ static int ila_del_mapping(struct net *net, struct ila_xlat_params *xp)
 			}
 		}
 
+		/* Invalidate cached pointers before the entry is freed;
+		 * the RCU grace period behind ila_release() orders the
+		 * bump against any reader still holding the old pointer.
+		 */
+		ila_xlat_cache_inval(ilan);
 		ila_release(ila);
 
 		break;
@@ -406,8 +470,10 @@ int ila_xlat_nl_cmd_flush(struct sk_buff *skb, struct genl_info *info)
 
 		ret = rhashtable_remove_fast(&ilan->xlat.rhash_table,
 					     &ila->node, rht_params);
-		if (!ret)
+		if (!ret) {
+			ila_xlat_cache_inval(ilan);
 			ila_free_node(ila);
+		}
 
 		spin_unlock(lock);
 
@@ -607,17 +673,25 @@ int ila_xlat_init_net(struct net *net)
 	struct ila_net *ilan = net_generic(net, ila_net_id);
 	int err;
 
+	ilan->xlat.cache = alloc_percpu(struct ila_xlat_cache);
+	if (!ilan->xlat.cache)
+		return -ENOMEM;
+
 	err = alloc_ila_locks(ilan);
 	if (err)
-		return err;
+		goto err_free_cache;
 
 	err = rhashtable_init(&ilan->xlat.rhash_table, &rht_params);
 	if (err) {
 		free_bucket_spinlocks(ilan->xlat.locks);
-		return err;
+		goto err_free_cache;
 	}
 
 	return 0;
+
+err_free_cache:
+	free_percpu(ilan->xlat.cache);
+	return err;
 }
 
 void ila_xlat_pre_exit_net(struct net *net)
@@ -636,6 +710,8 @@ void ila_xlat_exit_net(struct net *net)
 	rhashtable_free_and_destroy(&ilan->xlat.rhash_table, ila_free_cb, NULL);
 
 	free_bucket_spinlocks(ilan->xlat.locks);
+
+	free_percpu(ilan->xlat.cache);
 }
 
 static int ila_xlat_addr(struct sk_buff *skb, bool sir2ila)
@@ -655,7 +731,7 @@ static int ila_xlat_addr(struct sk_buff *skb, bool sir2ila)
 
 	rcu_read_lock();
 
-	ila = ila_lookup_wildcards(iaddr, skb->dev->ifindex, ilan);
+	ila = ila_xlat_cached_lookup(ilan, iaddr, skb->dev->ifindex);
 	if (ila)
 		ila_update_ipv6_locator(skb, &ila->xp.ip, sir2ila);
 
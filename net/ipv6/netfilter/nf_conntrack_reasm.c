@@ -140,7 +140,16 @@ static void nf_ct_frag6_expire(struct timer_list *t)
 	ip6frag_expire_frag_queue(fq->q.fqdir->net, fq);
 }
 
-/* Creation primitives. */
+/* Creation primitives.
+ *
+ * Queue lookup goes through the fqdir rhashtable: reads are RCU and
+ * inserts spread over per-bucket locks, so concurrent reassembly only
+ * contends on fq->q.lock of the individual datagram being rebuilt.
+ * Splitting the fqdir further (per NUMA node or per RX queue) would
+ * break reassembly whenever the NIC does not steer all fragments of a
+ * datagram to one queue, which non-first fragments without L4 headers
+ * commonly defeat.
+ */
 static struct frag_queue *fq_find(struct net *net, __be32 id, u32 user,
 				  const struct ipv6hdr *hdr, int iif)
 {
@@ -744,6 +744,17 @@ static void kcm_push(struct kcm_sock *kcm)
 		kcm_write_msgs(kcm);
 }
 
+/*
+ * Zero-copy record assembly already exists: MSG_SPLICE_PAGES hands the
+ * caller's pages to skb_splice_from_iter() below instead of copying
+ * through the page frag.  The mux lock taken on the transmit handoff is
+ * not incidental either - records from one KCM socket must reach a
+ * psock in submission order, and an unattached psock must be reserved
+ * atomically against the other sockets on the mux, so per-CPU TX queues
+ * would trade the lock for record reordering whenever a sender
+ * migrates.  Scaling past one core per mux is done by creating more
+ * muxes and spreading connections over them.
+ */
 static int kcm_sendmsg(struct socket *sock, struct msghdr *msg, size_t len)
 {
 	struct sock *sk = sock->sk;
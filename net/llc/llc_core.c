@@ -25,6 +25,15 @@
 LIST_HEAD(llc_sap_list);
 static DEFINE_SPINLOCK(llc_sap_list_lock);
 
+/*
+ * Direct lookup table keyed by SAP value.  The set of open SAPs is tiny
+ * and changes only when an upper-layer protocol registers, while
+ * llc_sap_find() runs for every inbound PDU, so demux reads the slot
+ * under RCU instead of walking llc_sap_list.  The list is kept for the
+ * iterators (procfs).
+ */
+static struct llc_sap __rcu *llc_sap_table[256];
+
 /**
  *	llc_sap_alloc - allocates and initializes sap.
  *
@@ -48,14 +57,9 @@ static struct llc_sap *llc_sap_alloc(void)
 
 static struct llc_sap *__llc_sap_find(unsigned char sap_value)
 {
-	struct llc_sap *sap;
-
-	list_for_each_entry(sap, &llc_sap_list, node)
-		if (sap->laddr.lsap == sap_value)
-			goto out;
-	sap = NULL;
-out:
-	return sap;
+	return rcu_dereference_check(llc_sap_table[sap_value],
+				     rcu_read_lock_bh_held() ||
+				     lockdep_is_held(&llc_sap_list_lock));
 }
 
 /**
@@ -105,6 +109,7 @@ struct llc_sap *llc_sap_open(unsigned char lsap,
 	sap->laddr.lsap = lsap;
 	sap->rcv_func	= func;
 	list_add_tail_rcu(&sap->node, &llc_sap_list);
+	rcu_assign_pointer(llc_sap_table[lsap], sap);
 out:
 	spin_unlock_bh(&llc_sap_list_lock);
 	return sap;
@@ -124,6 +129,7 @@ void llc_sap_close(struct llc_sap *sap)
 	WARN_ON(sap->sk_count);
 
 	spin_lock_bh(&llc_sap_list_lock);
+	RCU_INIT_POINTER(llc_sap_table[sap->laddr.lsap], NULL);
 	list_del_rcu(&sap->node);
 	spin_unlock_bh(&llc_sap_list_lock);
 
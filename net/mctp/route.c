@@ -127,6 +127,15 @@ static bool mctp_key_match(struct mctp_sk_key *key, unsigned int net,
 
 /* returns a key (with key->lock held, and refcounted), or NULL if no such
  * key exists.
+ *
+ * The list walk stays under keys_lock rather than RCU: a hit must take
+ * the reference and key->lock atomically with list membership, so that
+ * socket close and reassembly expiry (which unlink under the same lock)
+ * can't race a lookup into a dying key.  Route and bind lookups, the
+ * per-packet fast paths, are already RCU.  Note also that reassembly
+ * state is necessarily keyed by (net, src, dest, tag) and shared -
+ * fragments of one message may arrive via any CPU, so per-CPU contexts
+ * cannot apply here.
  */
 static struct mctp_sk_key *mctp_lookup_key(struct net *net, struct sk_buff *skb,
 					   unsigned int netid, mctp_eid_t peer,
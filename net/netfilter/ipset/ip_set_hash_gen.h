@@ -617,6 +617,16 @@ mtype_del(struct ip_set *set, void *value, const struct ip_set_ext *ext,
 /* Resize a hash: create a new hash table with doubling the hashsize
  * and inserting the elements to it. Repeat until we succeed or
  * fail due to memory pressures.
+ *
+ * Packet matching never waits on a resize: mtype_kadt runs under RCU
+ * against whichever table h->table points to, the copy loop below only
+ * takes rcu_read_lock_bh() itself, and the old table is kept alive via
+ * uref until the switch-over has gone through a grace period. Only the
+ * resizing (userspace) context blocks; kernel-side add/del from the SET
+ * target are queued on h->ad and replayed afterwards. An incremental,
+ * rhashtable-style split would buy nothing here since there is no
+ * reader-visible stall to remove, while walking two tables would slow
+ * down every lookup for the duration of the resize.
  */
 static int
 mtype_resize(struct ip_set *set, bool retried)
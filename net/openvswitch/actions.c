@@ -1384,6 +1384,15 @@ static int do_execute_actions(struct datapath *dp, struct sk_buff *skb,
 			/* Every output action needs a separate clone
 			 * of 'skb', In case the output action is the
 			 * last action, cloning can be avoided.
+			 *
+			 * Note that the clone only duplicates the skb
+			 * metadata and takes a reference on the shared
+			 * data; the payload is not copied here.  If a
+			 * later action in the list modifies the packet,
+			 * skb_ensure_writable()/skb_cow() in that action
+			 * performs the copy at that point, so multi-port
+			 * flows that only mirror the packet never copy
+			 * the payload at all.
 			 */
 			if (nla_is_last(a, rem)) {
 				do_output(dp, skb, port, key);
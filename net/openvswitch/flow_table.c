@@ -773,6 +773,59 @@ static struct sw_flow *flow_lookup(struct flow_table *tbl,
 	return NULL;
 }
 
+/* Single-mask lookup using the bucket hash remembered in the mask cache,
+ * avoiding the jhash over the masked key on the fast path.  The key
+ * comparison below makes a false match impossible, so a stale hint (flow
+ * removed, table rehashed, skb_hash collision) simply misses and we fall
+ * back to the normal mask scan, which refreshes the hint.
+ */
+static struct sw_flow *flow_lookup_cached(struct flow_table *tbl,
+					  struct table_instance *ti,
+					  struct mask_array *ma,
+					  const struct sw_flow_key *key,
+					  u32 *n_mask_hit,
+					  u32 *n_cache_hit,
+					  struct mask_cache_entry *ce)
+{
+	struct sw_flow_key masked_key;
+	struct sw_flow_mask *mask;
+	struct hlist_head *head;
+	struct sw_flow *flow;
+
+	if (unlikely(ce->mask_index >= ma->max))
+		goto scan;
+	mask = rcu_dereference_ovsl(ma->masks[ce->mask_index]);
+	if (unlikely(!mask))
+		goto scan;
+
+	ovs_flow_mask_key(&masked_key, key, false, mask);
+	head = find_bucket(ti, ce->flow_hash);
+	(*n_mask_hit)++;
+
+	hlist_for_each_entry_rcu(flow, head, flow_table.node[ti->node_ver],
+				 lockdep_ovsl_is_held()) {
+		if (flow->mask == mask &&
+		    flow->flow_table.hash == ce->flow_hash &&
+		    flow_cmp_masked_key(flow, &masked_key, &mask->range)) {
+			struct mask_array_stats *stats =
+				this_cpu_ptr(ma->masks_usage_stats);
+
+			u64_stats_update_begin(&stats->syncp);
+			stats->usage_cntrs[ce->mask_index]++;
+			u64_stats_update_end(&stats->syncp);
+			(*n_cache_hit)++;
+			return flow;
+		}
+	}
+
+scan:
+	flow = flow_lookup(tbl, ti, ma, key, n_mask_hit, n_cache_hit,
+			   &ce->mask_index);
+	if (flow)
+		ce->flow_hash = flow->flow_table.hash;
+	return flow;
+}
+
 /*
  * mask_cache maps flow to probable mask. This cache is not tightly
  * coupled cache, It means updates to  mask list can result in inconsistent
@@ -821,8 +874,8 @@ struct sw_flow *ovs_flow_tbl_lookup_stats(struct flow_table *tbl,
 
 		e = &entries[index];
 		if (e->skb_hash == skb_hash) {
-			flow = flow_lookup(tbl, ti, ma, key, n_mask_hit,
-					   n_cache_hit, &e->mask_index);
+			flow = flow_lookup_cached(tbl, ti, ma, key, n_mask_hit,
+						  n_cache_hit, e);
 			if (!flow)
 				e->skb_hash = 0;
 			return flow;
@@ -837,8 +890,10 @@ struct sw_flow *ovs_flow_tbl_lookup_stats(struct flow_table *tbl,
 	/* Cache miss, do full lookup. */
 	flow = flow_lookup(tbl, ti, ma, key, n_mask_hit, n_cache_hit,
 			   &ce->mask_index);
-	if (flow)
+	if (flow) {
 		ce->skb_hash = skb_hash;
+		ce->flow_hash = flow->flow_table.hash;
+	}
 
 	*n_cache_hit = 0;
 	return flow;
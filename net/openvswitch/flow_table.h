@@ -25,6 +25,7 @@
 struct mask_cache_entry {
 	u32 skb_hash;
 	u32 mask_index;
+	u32 flow_hash;	/* Bucket hash of the last flow this entry matched. */
 };
 
 struct mask_cache {
@@ -603,8 +603,13 @@ static void prb_setup_retire_blk_timer(struct packet_sock *po)
 	struct tpacket_kbdq_core *pkc;
 
 	pkc = GET_PBDQC_FROM_RB(&po->rx_ring);
+	/* Pin the timer so that re-arming it when a block opens keeps it
+	 * on the CPU that is filling the ring. Letting it wander to
+	 * another core means the expiry handler drags the receive queue
+	 * lock and the kbdq state across caches for no benefit.
+	 */
 	timer_setup(&pkc->retire_blk_timer, prb_retire_rx_blk_timer_expired,
-		    0);
+		    TIMER_PINNED);
 	pkc->retire_blk_timer.expires = jiffies;
 }
 
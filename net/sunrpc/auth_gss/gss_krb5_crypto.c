@@ -315,17 +315,16 @@ gss_krb5_checksum(struct crypto_ahash *tfm, char *header, int hdrlen,
 		  const struct xdr_buf *body, int body_offset,
 		  struct xdr_netobj *cksumout)
 {
+	u8 checksumdata[HASH_MAX_DIGESTSIZE];
 	struct ahash_request *req;
-	int err = -ENOMEM;
-	u8 *checksumdata;
-
-	checksumdata = kmalloc(crypto_ahash_digestsize(tfm), GFP_KERNEL);
-	if (!checksumdata)
-		return GSS_S_FAILURE;
+	int err;
 
+	/* The digest is written directly by the sync hash transform, so
+	 * a stack buffer is fine; it is never mapped into a scatterlist.
+	 */
 	req = ahash_request_alloc(tfm, GFP_KERNEL);
 	if (!req)
-		goto out_free_cksum;
+		return GSS_S_FAILURE;
 	ahash_request_set_callback(req, CRYPTO_TFM_REQ_MAY_SLEEP, NULL, NULL);
 	err = crypto_ahash_init(req);
 	if (err)
@@ -359,8 +358,7 @@ gss_krb5_checksum(struct crypto_ahash *tfm, char *header, int hdrlen,
 
 out_free_ahash:
 	ahash_request_free(req);
-out_free_cksum:
-	kfree_sensitive(checksumdata);
+	memzero_explicit(checksumdata, sizeof(checksumdata));
 	return err ? GSS_S_FAILURE : GSS_S_COMPLETE;
 }
 EXPORT_SYMBOL_IF_KUNIT(gss_krb5_checksum);
@@ -875,29 +873,26 @@ u32 krb5_etm_checksum(struct crypto_sync_skcipher *cipher,
 		      struct crypto_ahash *tfm, const struct xdr_buf *body,
 		      int body_offset, struct xdr_netobj *cksumout)
 {
+	/* For RPCSEC, the "initial cipher state" is always all zeroes. */
+	static const u8 zero_iv[GSS_KRB5_MAX_BLOCKSIZE];
 	unsigned int ivsize = crypto_sync_skcipher_ivsize(cipher);
+	u8 checksumdata[HASH_MAX_DIGESTSIZE];
 	struct ahash_request *req;
 	struct scatterlist sg[1];
-	u8 *iv, *checksumdata;
-	int err = -ENOMEM;
+	int err;
 
-	checksumdata = kmalloc(crypto_ahash_digestsize(tfm), GFP_KERNEL);
-	if (!checksumdata)
+	if (WARN_ON_ONCE(ivsize > sizeof(zero_iv)))
 		return GSS_S_FAILURE;
-	/* For RPCSEC, the "initial cipher state" is always all zeroes. */
-	iv = kzalloc(ivsize, GFP_KERNEL);
-	if (!iv)
-		goto out_free_mem;
 
 	req = ahash_request_alloc(tfm, GFP_KERNEL);
 	if (!req)
-		goto out_free_mem;
+		return GSS_S_FAILURE;
 	ahash_request_set_callback(req, CRYPTO_TFM_REQ_MAY_SLEEP, NULL, NULL);
 	err = crypto_ahash_init(req);
 	if (err)
 		goto out_free_ahash;
 
-	sg_init_one(sg, iv, ivsize);
+	sg_init_one(sg, zero_iv, ivsize);
 	ahash_request_set_crypt(req, sg, NULL, ivsize);
 	err = crypto_ahash_update(req);
 	if (err)
@@ -915,9 +910,7 @@ u32 krb5_etm_checksum(struct crypto_sync_skcipher *cipher,
 
 out_free_ahash:
 	ahash_request_free(req);
-out_free_mem:
-	kfree(iv);
-	kfree_sensitive(checksumdata);
+	memzero_explicit(checksumdata, sizeof(checksumdata));
 	return err ? GSS_S_FAILURE : GSS_S_COMPLETE;
 }
 EXPORT_SYMBOL_IF_KUNIT(krb5_etm_checksum);
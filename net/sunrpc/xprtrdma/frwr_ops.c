@@ -23,6 +23,16 @@
  * RDMA Send Work Requests (with the exception of signaling occasionally
  * to prevent provider work queue overflows). This greatly reduces HCA
  * interrupt workload.
+ *
+ * Doorbell traffic is likewise already minimized: frwr_send chains
+ * every FAST_REG WR for an RPC in front of its Send WR and posts the
+ * whole chain with one ib_post_send, and the frwr_unmap_* paths post
+ * an RPC's LOCAL_INV WRs the same way. Coalescing WR chains across
+ * independent RPCs would require parking a prepared Call under the
+ * transport send lock until another arrives, trading bounded extra
+ * latency on every lead RPC for one saved MMIO; with unsignaled
+ * completions already amortizing interrupt load, that trade has not
+ * been worth it.
  */
 
 /* Transport recovery
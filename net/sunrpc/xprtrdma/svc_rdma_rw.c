@@ -51,6 +51,14 @@ svc_rdma_next_ctxt(struct list_head *list)
 					rw_list);
 }
 
+/* R/W contexts are allocated on the ib_device's NUMA node on first
+ * use and then recycled through the transport's sc_rw_ctxts llist, so
+ * steady-state traffic sees no allocator activity here apart from
+ * sg_alloc_table_chained() spilling past the inline SGL on large
+ * payloads. The cache is per-transport rather than per-CQ on purpose:
+ * contexts embed device-specific SGL sizing, and a CQ-wide pool would
+ * reintroduce a lock shared by all connections on the CQ.
+ */
 static struct svc_rdma_rw_ctxt *
 svc_rdma_get_rw_ctxt(struct svcxprt_rdma *rdma, unsigned int sges)
 {
@@ -192,13 +192,26 @@ next:
 static void tls_strp_flush_anchor_copy(struct tls_strparser *strp)
 {
 	struct skb_shared_info *shinfo = skb_shinfo(strp->anchor);
-	int i;
+	int i, keep = 0;
 
 	DEBUG_NET_WARN_ON_ONCE(atomic_read(&shinfo->dataref) != 1);
 
-	for (i = 0; i < shinfo->nr_frags; i++)
+	for (i = 0; i < shinfo->nr_frags; i++) {
+		struct page *page = skb_frag_page(&shinfo->frags[i]);
+
+		/* Hold on to pages we own exclusively so the next copy-mode
+		 * record can reuse them instead of going back to the page
+		 * allocator. Order-0 only, the copyin code assumes one
+		 * PAGE_SIZE chunk per frag.
+		 */
+		if (!PageCompound(page) && page_ref_count(page) == 1) {
+			skb_frag_fill_page_desc(&shinfo->frags[keep++],
+						page, 0, 0);
+			continue;
+		}
 		__skb_frag_unref(&shinfo->frags[i], false);
-	shinfo->nr_frags = 0;
+	}
+	shinfo->nr_frags = keep;
 	if (strp->copy_mode) {
 		kfree_skb_list(shinfo->frag_list);
 		shinfo->frag_list = NULL;
@@ -386,7 +399,7 @@ static int tls_strp_read_copy(struct tls_strparser *strp, bool qshort)
 {
 	struct skb_shared_info *shinfo;
 	struct page *page;
-	int need_spc, len;
+	int need_spc, cnt;
 
 	/* If the rbuf is small or rcv window has collapsed to 0 we need
 	 * to read the data out. Otherwise the connection will stall.
@@ -400,15 +413,21 @@ static int tls_strp_read_copy(struct tls_strparser *strp, bool qshort)
 
 	/* If we don't know the length go max plus page for cipher overhead */
 	need_spc = strp->stm.full_len ?: TLS_MAX_PAYLOAD_SIZE + PAGE_SIZE;
+	cnt = DIV_ROUND_UP(need_spc, PAGE_SIZE);
 
-	for (len = need_spc; len > 0; len -= PAGE_SIZE) {
+	/* Reuse the pages retained from the previous record, then fill in
+	 * the rest from the allocator.
+	 */
+	while (shinfo->nr_frags > cnt)
+		__skb_frag_unref(&shinfo->frags[--shinfo->nr_frags], false);
+	while (shinfo->nr_frags < cnt) {
 		page = alloc_page(strp->sk->sk_allocation);
 		if (!page) {
 			tls_strp_flush_anchor_copy(strp);
 			return -ENOMEM;
 		}
 
-		skb_fill_page_desc(strp->anchor, shinfo->nr_frags++,
+		skb_fill_page_desc(strp->anchor, shinfo->nr_frags,
 				   page, 0, 0);
 	}
 
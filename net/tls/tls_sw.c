@@ -1009,7 +1009,6 @@ static int tls_sw_sendmsg_locked(struct sock *sk, struct msghdr *msg,
 	struct tls_context *tls_ctx = tls_get_ctx(sk);
 	struct tls_prot_info *prot = &tls_ctx->prot_info;
 	struct tls_sw_context_tx *ctx = tls_sw_ctx_tx(tls_ctx);
-	bool async_capable = ctx->async_capable;
 	unsigned char record_type = TLS_RECORD_TYPE_DATA;
 	bool is_kvec = iov_iter_is_kvec(&msg->msg_iter);
 	bool eor = !(msg->msg_flags & MSG_MORE);
@@ -1100,7 +1099,14 @@ alloc_encrypted:
 			continue;
 		}
 
-		if (!is_kvec && (full_record || eor) && !async_capable) {
+		/* Encrypt directly from pinned user pages rather than copying
+		 * into kernel memory first.  This is safe with an async aead
+		 * as well: whenever a zerocopy record was queued (num_zc),
+		 * every exit path below waits for all pending encryptions
+		 * before returning, so the user buffer cannot be reused
+		 * while the crypto engine is still reading from it.
+		 */
+		if (!is_kvec && (full_record || eor)) {
 			u32 first = msg_pl->sg.end;
 
 			ret = sk_msg_zerocopy_from_iter(sk, &msg->msg_iter,
@@ -1219,6 +1225,20 @@ trim_sgl:
 	}
 
 send_end:
+	if (num_zc && num_async) {
+		int err;
+
+		/* A queued zerocopy record keeps the user pages pinned only
+		 * while its async encryption is in flight.  Drain pending
+		 * encryptions before handing the buffer back to userspace,
+		 * even when bailing out early on error.
+		 */
+		err = tls_encrypt_async_wait(ctx);
+		if (err) {
+			ret = err;
+			copied = 0;
+		}
+	}
 	ret = sk_stream_error(sk, msg->msg_flags, ret);
 	return copied > 0 ? copied : ret;
 }
@@ -1185,6 +1185,15 @@ static __poll_t vsock_poll(struct file *file, struct socket *sock,
 	return mask;
 }
 
+/*
+ * This hook, together with the sockmap proto update in vsock_bpf.c, is the
+ * in-kernel relay path: a proxy inserts both vsock sockets into a sockmap
+ * and an attached sk_skb verdict program forwards skbs between them with
+ * SK_REDIRECT, so payloads move queue-to-queue in the kernel with the BPF
+ * program as the policy point and sockmap keeping the byte accounting.
+ * A dedicated pairwise splice facility would duplicate that with less
+ * flexibility.
+ */
 static int vsock_read_skb(struct sock *sk, skb_read_actor_t read_actor)
 {
 	struct vsock_sock *vsk = vsock_sk(sk);
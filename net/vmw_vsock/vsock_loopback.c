@@ -26,6 +26,15 @@ static u32 vsock_loopback_get_local_cid(void)
 	return VMADDR_CID_LOCAL;
 }
 
+/*
+ * Delivery always bounces through the workqueue, even if the receiver
+ * is polling.  Calling virtio_transport_recv_pkt() from here would run
+ * with the sender's socket lock held while taking the destination's -
+ * a self-connected socket would deadlock on its own lock, and two
+ * sockets sending to each other would deadlock on ordering.  The
+ * worker also provides the fresh context the recv path assumes (it
+ * may sleep in sk_wait and allocate for the rx queue).
+ */
 static int vsock_loopback_send_pkt(struct sk_buff *skb)
 {
 	struct vsock_loopback *vsock = &the_vsock_loopback;
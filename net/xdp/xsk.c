@@ -384,6 +384,14 @@ int __xsk_map_redirect(struct xdp_sock *xs, struct xdp_buff *xdp)
 	return 0;
 }
 
+/* Userspace wakeups are already coalesced here: sockets that received
+ * during a NAPI poll sit on the flush list and get a single ring
+ * submit plus sock_def_readable() per batch, however many frames were
+ * redirected to them. Applications that want time-based aggregation on
+ * top of this should use SO_PREFER_BUSY_POLL with SO_BUSY_POLL and
+ * SO_BUSY_POLL_BUDGET; xsk_no_wakeup() then suppresses the driver
+ * kicks from the syscall path as well.
+ */
 void __xsk_map_flush(struct list_head *flush_list)
 {
 	struct xdp_sock *xs, *tmp;
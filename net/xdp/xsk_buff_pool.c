@@ -42,10 +42,22 @@ void xp_destroy(struct xsk_buff_pool *pool)
 	kvfree(pool);
 }
 
+/* Keep the pool metadata on the same NUMA node as the umem pages, so
+ * that the driver Rx path does not take remote misses on xdp_buff_xsk
+ * state while the frame data itself is local.
+ */
+static int xp_umem_node(struct xdp_umem *umem)
+{
+	if (!umem->pgs)
+		return NUMA_NO_NODE;
+	return page_to_nid(umem->pgs[0]);
+}
+
 int xp_alloc_tx_descs(struct xsk_buff_pool *pool, struct xdp_sock *xs)
 {
-	pool->tx_descs = kvcalloc(xs->tx->nentries, sizeof(*pool->tx_descs),
-				  GFP_KERNEL);
+	pool->tx_descs = kvcalloc_node(xs->tx->nentries,
+				       sizeof(*pool->tx_descs), GFP_KERNEL,
+				       xp_umem_node(pool->umem));
 	if (!pool->tx_descs)
 		return -ENOMEM;
 
@@ -61,11 +73,14 @@ struct xsk_buff_pool *xp_create_and_assign_umem(struct xdp_sock *xs,
 	u32 i, entries;
 
 	entries = unaligned ? umem->chunks : 0;
-	pool = kvzalloc(struct_size(pool, free_heads, entries),	GFP_KERNEL);
+	pool = kvzalloc_node(struct_size(pool, free_heads, entries),
+			     GFP_KERNEL, xp_umem_node(umem));
 	if (!pool)
 		goto out;
 
-	pool->heads = kvcalloc(umem->chunks, sizeof(*pool->heads), GFP_KERNEL);
+	pool->umem = umem;
+	pool->heads = kvcalloc_node(umem->chunks, sizeof(*pool->heads),
+				    GFP_KERNEL, xp_umem_node(umem));
 	if (!pool->heads)
 		goto out;
 
@@ -83,7 +98,6 @@ struct xsk_buff_pool *xp_create_and_assign_umem(struct xdp_sock *xs,
 	pool->unaligned = unaligned;
 	pool->frame_len = umem->chunk_size - umem->headroom -
 		XDP_PACKET_HEADROOM;
-	pool->umem = umem;
 	pool->addrs = umem->addrs;
 	pool->tx_metadata_len = umem->tx_metadata_len;
 	pool->tx_sw_csum = umem->flags & XDP_UMEM_TX_SW_CSUM;